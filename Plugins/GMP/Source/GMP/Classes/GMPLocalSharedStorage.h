@@ -16,15 +16,48 @@ enum ELocalSharedOverrideMode : uint8
 	Override,
 };
 
+namespace GMP
+{
+struct FLocalSharedSlotData
+{
+	FName Key;
+	FName NotifyKey;
+	const FProperty* Prop = nullptr;
+	// stored value, refreshed on every set, nullptr while unset or holding another type
+	void* Addr = nullptr;
+	// object slots point Addr here
+	UObject* Object = nullptr;
+	uint32 Version = 0;
+};
+}  // namespace GMP
+
+template<typename T>
+class TLocalSharedSlot;
+
 UCLASS(Transient)
 class GMP_API ULocalSharedStorage : public UBlueprintFunctionLibrary
 {
 	GENERATED_BODY()
 public:
+	// Typed slot resolved once for Key, then read and written through the stored value address.
+	// Every successful set of Key (slot or FName api) bumps the slot version and, if NotifyKey is given,
+	// publishes (FName Key, int32 Version) on NotifyKey with GetStorageSource(InCtx) as source.
+	// Returns an invalid slot if Key is already resolved as another type.
+	template<typename T>
+	static TLocalSharedSlot<T> FindOrAddSlot(const UObject* InCtx, FName Key, FName NotifyKey = NAME_None)
+	{
+		TLocalSharedSlot<T> Ret;
+		Ret.Slot = FindOrAddSlotImpl(InCtx, Key, GMP::TClass2Prop<T>::GetProperty(), NotifyKey, Ret.Storage);
+		return Ret;
+	}
+	static UObject* GetStorageSource(const UObject* InCtx);
+	// Drops the value of Key. Slots of Key stay bound and read null until Key is set again, the removal counts as a change.
+	static bool RemoveLocalSharedStorage(const UObject* InCtx, FName Key);
+
 	template<typename T>
 	static bool SetLocalSharedStorage(const UObject* InCtx, FName Key, T& Data, ELocalSharedOverrideMode Mode = ELocalSharedOverrideMode::Skip)
 	{
-		return SetLocalSharedStorage(InCtx, Key, Mode, GMP::TClass2Prop<T>::GetProperty(), std::addressof(Data));
+		return SetLocalSharedStorageImpl(InCtx, Key, Mode, GMP::TClass2Prop<T>::GetProperty(), std::addressof(Data));
 	}
 
 	template<typename T>
@@ -56,4 +89,36 @@ private:
 	static bool SetLocalSharedStorageImpl(const UObject* InCtx, FName Key, ELocalSharedOverrideMode Mode, const FProperty* Prop, const void* Data);
 	static void* GetLocalSharedStorageImpl(const UObject* InCtx, FName Key, const FProperty* Prop);
 	static class ULocalSharedStorageInternal* GetInternal(const UObject* InCtx);
+
+	template<typename T>
+	friend class TLocalSharedSlot;
+	static TSharedPtr<GMP::FLocalSharedSlotData> FindOrAddSlotImpl(const UObject* InCtx, FName Key, const FProperty* Prop, FName NotifyKey, TWeakObjectPtr<UObject>& OutStorage);
+	static bool SetSlotImpl(UObject* Storage, GMP::FLocalSharedSlotData& Slot, ELocalSharedOverrideMode Mode, const void* Data);
+};
+
+template<typename T>
+class TLocalSharedSlot
+{
+public:
+	bool IsValid() const { return Slot.IsValid() && Storage.IsValid(); }
+	explicit operator bool() const { return IsValid(); }
+
+	// nullptr until the key has been set
+	const T* Get() const { return IsValid() ? static_cast<const T*>(Slot->Addr) : nullptr; }
+	uint32 GetVersion() const { return IsValid() ? Slot->Version : 0; }
+	// true once per change: compares against and then updates the version the caller last saw
+	bool HasChanged(uint32& InOutVersion) const
+	{
+		const uint32 Version = GetVersion();
+		const bool bChanged = Version != InOutVersion;
+		InOutVersion = Version;
+		return bChanged;
+	}
+
+	bool Set(const T& Data, ELocalSharedOverrideMode Mode = ELocalSharedOverrideMode::Override) const { return IsValid() && ULocalSharedStorage::SetSlotImpl(Storage.Get(), *Slot, Mode, std::addressof(Data)); }
+
+private:
+	friend class ULocalSharedStorage;
+	TWeakObjectPtr<UObject> Storage;
+	TSharedPtr<GMP::FLocalSharedSlotData> Slot;
 };
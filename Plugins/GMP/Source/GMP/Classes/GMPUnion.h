@@ -494,6 +494,8 @@ private:
 	GMP_API void InitFrom(FFrame& Stack);
 	GMP_API void InitFrom(FName MsgKey, const FGMPPropStackRefArray& Arr, bool bStore = false);
 
+	bool NetSerializeDelta(FArchive& Ar, UPackageMap* Map, int32 InArrNum);
+
 	friend class UGMPDynStructStorage;
 	friend class UGMPStructLib;
 	friend struct FGMPStructTuple;
@@ -527,6 +529,28 @@ struct FGMPStoreSourceMsgs : public TMap<FSigSource, FGMPStructUnion>
 {
 	using TMap<FSigSource, FGMPStructUnion>::TMap;
 };
+
+// Opt-in delta encoding for FGMPStructUnion::NetSerialize (gmp.net.UnionDelta 1).
+// While the scope is open, unions written with InMap send their struct as a per-connection index after the first send,
+// and only the fields that changed since the last value of the same struct type on that connection (one bit per field).
+// Both ends must enable it and decode delta payloads in send order, so only open it around reliable, ordered writes.
+struct GMP_API FUnionNetDeltaScope
+{
+	FUnionNetDeltaScope(UPackageMap* InMap, bool bEnable = true);
+	~FUnionNetDeltaScope();
+	FUnionNetDeltaScope(const FUnionNetDeltaScope&) = delete;
+	FUnionNetDeltaScope& operator=(const FUnionNetDeltaScope&) = delete;
+
+private:
+	UPackageMap* PrevMap;
+};
+// Drops the sending shadow state of a connection, the following delta writes start over with full payloads
+GMP_API void ResetUnionNetShadow(UPackageMap* InMap);
+// Drops the receiving shadow state of a connection after a payload could not be decoded.
+// Delta payloads fail to decode from then on until the peer calls ResetUnionNetShadow for the same connection.
+GMP_API void ResetUnionNetReceiveShadow(UPackageMap* InMap);
+// gmp.net.UnionDelta, without it no shadow is kept and there is nothing to resync
+GMP_API bool IsUnionNetDeltaEnabled();
 }  // namespace GMP
 
 USTRUCT(BlueprintType, BlueprintInternalUseOnly)
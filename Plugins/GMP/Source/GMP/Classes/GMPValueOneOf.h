@@ -12,6 +12,33 @@
 #define WITH_GMPVALUE_ONEOF 1
 #endif
 
+// Pre-compiled multi-level key path (much like a JSON Pointer), build it once and resolve it against any number of values.
+// Each level is matched in place against the underlying json/proto value with the key already encoded, no intermediate
+// FGMPValueOneOf is created along the way.
+struct GMP_API FGMPValuePath
+{
+	FGMPValuePath() = default;
+	explicit FGMPValuePath(TConstArrayView<FName> InKeys);
+	// keys separated by '/' or '.', "a/b/c"
+	explicit FGMPValuePath(const FStringView& InPath);
+
+	int32 Num() const { return Segments.Num(); }
+	bool IsEmpty() const { return Segments.Num() == 0; }
+	FName GetKey(int32 Idx) const { return Segments[Idx].Key; }
+
+	struct FSegment
+	{
+		FName Key;
+		FString Str;
+		TArray<uint8> Utf8;
+	};
+	const FSegment& GetSegment(int32 Idx) const { return Segments[Idx]; }
+
+private:
+	void AddKey(FName InKey);
+	TArray<FSegment, TInlineAllocator<4>> Segments;
+};
+
 USTRUCT(BlueprintType, BlueprintInternalUseOnly)
 struct GMP_API FGMPValueOneOf
 {
@@ -39,6 +66,15 @@ public:
 		return false;
 #endif
 	}
+	template<typename T>
+	bool AsValue(T& Out, const FGMPValuePath& Path) const
+	{
+#if WITH_GMPVALUE_ONEOF
+		return AsValueImpl(GMP::TClass2Prop<T>::GetProperty(), &Out, Path);
+#else
+		return false;
+#endif
+	}
 
 	template<typename T>
 	bool AsStruct(T& Out, FName SubKey = {}, UScriptStruct* StructType = GMP::TypeTraits::StaticStruct<T>()) const
@@ -59,7 +95,9 @@ public:
 
 	int32 IterateKeyValue(int32 Idx, FString& OutKey, FGMPValueOneOf& OutValue) const { return IterateKeyValueImpl(Idx, OutKey, OutValue); }
 
-	bool LoadFromFile(const FString& FilePath, bool bBinary = false);
+	// bMapped: read through a memory mapping instead of a whole-file buffer (falls back when the file can not be mapped, e.g. inside a pak).
+	// json is parsed straight into this value's document, so neither the file contents nor an intermediate document are copied.
+	bool LoadFromFile(const FString& FilePath, bool bBinary = false, bool bMapped = false);
 	bool FromJsonStr(const FStringView& Content);
 	bool ToJsonStr(FString& Out) const;
 	FGMPValueOneOf SubValueOf(FName SubKey) const
@@ -80,6 +118,7 @@ protected:
 	bool AsStructImpl(UScriptStruct* Struct, void* Out, FName SubKey, bool bBinary = false) const { return AsValueImpl(GMP::Class2Prop::TTraitsStructBase::GetProperty(Struct), Out, SubKey, bBinary); }
 	bool AsValueImpl(FProperty* Prop, void* Out, TConstArrayView<FName> SubKeys, bool bBinary = false) const;
 	bool AsStructImpl(UScriptStruct* Struct, void* Out, TConstArrayView<FName> SubKeys, bool bBinary = false) const { return AsValueImpl(GMP::Class2Prop::TTraitsStructBase::GetProperty(Struct), Out, SubKeys, bBinary); }
+	bool AsValueImpl(FProperty* Prop, void* Out, const FGMPValuePath& Path, bool bBinary = false) const;
 	// zero if err or next index otherwise INDEX_NONE
 	int32 IterateKeyValueImpl(int32 Idx, FString& OutKey, FGMPValueOneOf& OutValue, bool bBinary = false) const;
 
@@ -6,10 +6,55 @@
 #include "GMPBPLib.h"
 #include "tuplet/tuple.hpp"
 
+#include <atomic>
 #include <type_traits>
 #include <utility>
 #include <tuple>
 
+namespace GMP
+{
+namespace FastCall
+{
+	struct FEligibilityTable;
+	// Tables are cleared after GC, reinstancing and hot reload, when a function address may start naming another function.
+	GMP_API void RegisterEligibilityTable(FEligibilityTable* Table);
+
+	// Per-UFunction yes/no verdicts readable from any thread without a lock. Direct mapped: a slot holds the function address
+	// with the verdict in its lowest bit (functions are at least pointer aligned), a collision only costs a recomputation.
+	struct FEligibilityTable
+	{
+		static constexpr int32 NumSlots = 64;
+
+		FEligibilityTable() { RegisterEligibilityTable(this); }
+
+		template<typename F>
+		bool FindOrAdd(const UFunction* Function, const F& Compute)
+		{
+			const UPTRINT Key = reinterpret_cast<UPTRINT>(Function);
+			std::atomic<UPTRINT>& Slot = Slots[((Key >> 4) ^ (Key >> 10)) & (NumSlots - 1)];
+			const UPTRINT Value = Slot.load(std::memory_order_acquire);
+			if ((Value & ~UPTRINT(1)) == Key)
+				return !!(Value & 1);
+
+			const bool bEligible = Compute();
+			Slot.store(Key | UPTRINT(bEligible), std::memory_order_release);
+			return bEligible;
+		}
+
+		void Reset()
+		{
+			for (auto& Slot : Slots)
+				Slot.store(0, std::memory_order_relaxed);
+		}
+
+		FEligibilityTable* Next = nullptr;
+
+	private:
+		std::atomic<UPTRINT> Slots[NumSlots] = {};
+	};
+}  // namespace FastCall
+}  // namespace GMP
+
 template<typename F, typename = void>
 struct TGMPBPFastCall;
 
@@ -103,8 +148,8 @@ class FGMPBPFastCallImpl
 	}
 
 	// Cache the ADMISSION gates (C1 layout + C4 non-ubergraph) per (template instance,
-	// UFunction*). The first call pays the reflection walk; every subsequent call is a
-	// TMap lookup. Shipping trusts the dev-verified invariant.
+	// UFunction*). The first call pays the reflection walk; every subsequent call is one
+	// atomic load. Shipping trusts the dev-verified invariant.
 	//
 	// NOTE: only C1 and C4 are admission gates. C3 (ParmsSize == PropertiesSize, i.e. no
 	// local variables) is NOT a gate -- a target WITH locals still takes the fast path,
@@ -113,21 +158,19 @@ class FGMPBPFastCallImpl
 	// parameter region layout (sizeof(tuple) == ParmsSize), which is independent of the
 	// local-variable region, so it composes correctly with locals present.
 	//
-	// Thread-safety: FastCall is game-thread only (like every GMP listener path), so the
-	// static TMap needs no lock.
+	// Thread-safety: the verdicts live in a lock-free FEligibilityTable, so the gate may be
+	// queried from any thread (the verdict is a pure function of the UFunction layout).
 	template<typename... Ts>
 	static bool IsFastCallEligible(UFunction* Function)
 	{
 #if UE_BUILD_SHIPPING
 		return true;
 #else
-		static TMap<const UFunction*, bool> Cache;
-		if (const bool* Hit = Cache.Find(Function))
-			return *Hit;
-		const bool bOk = !Function->HasAnyFunctionFlags(FUNC_UbergraphFunction)   // C4: not ubergraph
-					  && VerifyTupleLayout<Ts...>(Function);                       // C1: field-by-field
-		Cache.Add(Function, bOk);
-		return bOk;
+		static GMP::FastCall::FEligibilityTable Cache;
+		return Cache.FindOrAdd(Function, [Function] {
+			return !Function->HasAnyFunctionFlags(FUNC_UbergraphFunction)  // C4: not ubergraph
+				   && VerifyTupleLayout<Ts...>(Function);                  // C1: field-by-field
+		});
 #endif
 	}
 
@@ -112,6 +112,14 @@ public:
 	static void NotifyMessageByKeyVariadic(const FString& MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
 	DECLARE_FUNCTION(execNotifyMessageByKeyVariadic);
 
+	// Emitted by the notify node: the key is a name literal interned when the blueprint loads, no string to key conversion per call
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, AutoCreateRefTerm = "Sender", Variadic))
+	static bool NotifyMessageByNameVariadicRet(FName MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
+	DECLARE_FUNCTION(execNotifyMessageByNameVariadicRet);
+	UFUNCTION(BlueprintCallable, CustomThunk, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, AutoCreateRefTerm = "Sender", Variadic))
+	static void NotifyMessageByNameVariadic(FName MessageId, const FGMPObjNamePair& Sender, uint8 Type = 0, UGMPManager* Mgr = nullptr);
+	DECLARE_FUNCTION(execNotifyMessageByNameVariadic);
+
 	// RequestMessage
 	UFUNCTION(BlueprintCallable, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, HidePin = "Sender", DefaultToSelf = "Sender", AutoCreateRefTerm = "Params,MessageId"))
 	static bool RequestMessageRet(FGMPKey& RspKey, FName EventName, const FString& MessageId, const FGMPObjNamePair& Sender, UPARAM(ref) TArray<FGMPTypedAddr>& Params, uint8 Type = 0, UGMPManager* Mgr = nullptr);
@@ -259,6 +267,9 @@ public:
 	UFUNCTION(BlueprintCallable, CustomThunk, meta = (Variadic, BlueprintInternalUseOnly = true))
 	static void CallObjectFunctionByName(UObject* Obj, FName FuncName);
 	DECLARE_FUNCTION(execCallObjectFunctionByName);
+	// Native body of CallObjectFunctionByName: PinAddrs hold the pin values (script VM representation) in CPF_Parm order,
+	// null entries are left alone. Returns false if Obj has no such function.
+	static bool CallFunctionByName(UObject* Obj, FName FuncName, TArrayView<void* const> PinAddrs);
 
 	static bool CallEventFunction(UObject* Obj, const FName FuncName, const TArray<uint8>& Buffer, UPackageMap* PackageMap, EFunctionFlags VerifyFlags = FUNC_None);
 	static bool CallEventDelegate(UObject* Obj, const FName EventName, const TArray<uint8>& Buffer, UPackageMap* PackageMap);
@@ -278,10 +289,19 @@ public:
 	static void GetMemberByChain(UObject* InObject, const TArray<FName>& Chain, FGMPTypedAddr& OutValue);
 	DECLARE_FUNCTION(execGetMemberByChain);
 
+	// Same as GetMemberByChain with the chain baked into one name literal ("A.B.C") by the node at compile time,
+	// so an execution neither builds the chain array nor hashes it.
+	UFUNCTION(BlueprintPure, CustomThunk, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true, CustomStructureParam = "OutValue"))
+	static void GetMemberByChainName(UObject* InObject, FName ChainName, FGMPTypedAddr& OutValue);
+	DECLARE_FUNCTION(execGetMemberByChainName);
+
 	// Resolves the chain to the leaf property + its address. Returns false (and
 	// leaves OutAddr/OutProp untouched) if any hop fails or hits a null pointer.
 	// bIsObjectContainer: true => Container is a UObject*; false => raw struct addr.
 	static bool ResolveMemberChain(void* Container, UStruct* ContainerType, const TArray<FName>& Chain, void*& OutAddr, FProperty*& OutProp);
+	// Native body of GetMemberByChainName: copies the leaf into OutPtr if it has the type of OutProperty.
+	// Returns false (OutPtr untouched) for an empty or unresolvable chain or a type mismatch.
+	static bool CopyMemberByChainName(UObject* InObject, FName ChainName, FProperty* OutProperty, void* OutPtr);
 
 	//////////////////////////////////////////////////////////////////////////
 	UFUNCTION(BlueprintPure, CustomThunk, meta = (Variadic, CallableWithoutWorldContext, BlueprintInternalUseOnly = true))
@@ -308,6 +328,9 @@ public:
 	static FString FormatStringByName(const FString& InFmtStr, const TArray<FString>& InNames);
 	DECLARE_FUNCTION(execFormatStringByName);
 
+	// Rewrites a named format into the equivalent FormatStringByOrder format ({Name} -> {Index of Name}), false when it has no exact ordered equivalent
+	static bool BakeFormatByName(const FString& InFmtStr, const TArray<FString>& InNames, FString& OutOrderedFmt);
+
 	UFUNCTION(BlueprintPure, meta = (CallableWithoutWorldContext, BlueprintInternalUseOnly = true))
 	static FString FormatStringByNameLegacy(const FString& InFmtStr, const TMap<FString, FString>& InArgs);
 
@@ -91,6 +91,11 @@ struct GMP_API FNameSuccession
 	static FName GetClassName(UClass* InClass);
 	static FName GetNativeClassName(UClass* InClass);
 	static FName GetNativeClassPtrName(UClass* InClass);
+	// dense id of a type name, IsDerivedFrom and MatchEnums keep their verdicts as bitsets over these ids. Classes renamed
+	// by recompiles and reinstancing (REINST_, SKEL_, ...) get none and return INDEX_NONE.
+	static int32 GetTypeId(FName Type);
+	// drops the cached verdicts, for callers that change what a type name resolves to
+	static void InvalidateTypeCache();
 	static bool IsDerivedFrom(FName Type, FName ParentType);
 	static bool MatchEnums(FName IntType, FName EnumType);
 	static bool IsTypeCompatible(FName lhs, FName rhs);
@@ -402,6 +402,12 @@ public:
 	FORCEINLINE bool IsBound() const { return !!GetCallable(); }
 	FORCEINLINE auto GetCallable() const { return Storage.Callable; }
 	FORCEINLINE auto GetObjectAddress() const { return Storage.GetObjectAddress(); }
+	// size of the heap block owning the callable, zero when it lives in the inline storage
+	uint32_t GetHeapAllocatedSize() const
+	{
+		auto HeapObj = (IErasedObject*)Storage.GetHeapAllocation();
+		return HeapObj ? sizeof(IErasedObject) + HeapObj->GetObjectSize() : 0;
+	}
 
 	void Reset() { Storage.Reset(); }
 
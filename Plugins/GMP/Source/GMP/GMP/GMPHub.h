@@ -651,8 +651,7 @@ private:
 #endif
 #if GMP_WITH_DYNAMIC_CALL_CHECK
 		const auto& ArgNames = SendTraits::MakeNames(TupRef);
-		const FArrayTypeNames* OldParams = nullptr;
-		if (!IsSignatureCompatible(true, MessageKey, ArgNames, OldParams, GetNativeTagType()))
+		if (!IsSignatureCompatibleCached(DirectStore, MessageKey, ArgNames, GetNativeTagType()))
 		{
 			ensureAlwaysMsgf(false, TEXT("SignatureMismatch On Send %s"), *MessageKey.ToString());
 			return Ret;
@@ -866,6 +865,9 @@ public:
 	static const TCHAR* GetBlueprintTagType();
 
 	static bool IsSignatureCompatible(bool bCall, const FName& MessageId, const FArrayTypeNames& TypeNames, const FArrayTypeNames*& OldTypes, const TCHAR* TagType = nullptr);
+	// Send-side IsSignatureCompatible for a type list with a stable address (MakeStaticNames). Passing verdicts are
+	// memoized on the store until any registered signature changes, a null store or another thread always checks.
+	static bool IsSignatureCompatibleCached(FSignalStore* Store, const FName& MessageId, const FArrayTypeNames& StaticTypes, const TCHAR* TagType = nullptr);
 	static bool IsSingleshotCompatible(bool bCall, const FName& MessageId, const FArrayTypeNames& TypeNames, const FArrayTypeNames*& OldTypes, const TCHAR* TagType = nullptr);
 
 public:
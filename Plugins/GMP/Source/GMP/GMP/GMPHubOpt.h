@@ -41,8 +41,11 @@ namespace DirectTyped
 		const FArrayTypeNames& TypeNames = FMessageBody::MakeStaticNames((TupleType*)nullptr, std::index_sequence<Is...>{});
 		const FGMPExtra Extra{N, 0.f, TypeNames.GetData(), InSigSrc, Key, FGMPKey{}};
 #if GMP_WITH_INLINE_FIRE_ENABLED
+		GMP_TRACE_SEND_SCOPE(Key, InSigSrc, N, TypeNames.GetData());
+		FMessageSendScope SendScope;
 		Store->ForEachMatchedRaw(InSigSrc, paddrs, &Extra);
 #elif GMP_WITH_STATIC_STORE
+		GMP_TRACE_SEND_SCOPE(Key, InSigSrc, N, TypeNames.GetData());
 		GMP::GMPFireWithSigSourceDirectRaw(Store, InSigSrc, paddrs, &Extra);
 #else
 		FMessageUtils::GetMessageHub()->NotifyMessageDirectRaw(Store, InSigSrc, paddrs, &Extra);
@@ -58,8 +61,7 @@ FORCEINLINE auto SendObjectMessageDirect(const TKeySlot<KeyT>& KeySlot, FSigSour
 		return;
 #if GMP_WITH_DYNAMIC_CALL_CHECK
 	const auto& ArgNames = FMessageBody::MakeStaticNamesImpl<std::decay_t<Args>...>();
-	const FArrayTypeNames* OldParams = nullptr;
-	if (!FMessageUtils::GetMessageHub()->IsSignatureCompatible(true, KeySlot.GetKey(), ArgNames, OldParams, FMessageHub::GetNativeTagType()))
+	if (!FMessageHub::IsSignatureCompatibleCached(Store, KeySlot.GetKey(), ArgNames, FMessageHub::GetNativeTagType()))
 	{
 		ReportSendSignatureMismatch(KeySlot.GetKey());
 		return;
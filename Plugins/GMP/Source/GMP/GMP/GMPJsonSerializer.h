@@ -337,6 +337,8 @@ namespace Json
 		TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(Filename));
 		return Reader && UStructFromJson(*Reader, TypeTraits::StaticStruct<DataType>(), (uint8*)std::addressof(OutData));
 	}
+	// utf8 (optionally with BOM) parsed directly into the value's own document, no intermediate copy
+	GMP_API bool OneOfFromJsonImpl(TArrayView<const uint8> In, FGMPValueOneOf& OutValue);
 
 	namespace Serializer
 	{
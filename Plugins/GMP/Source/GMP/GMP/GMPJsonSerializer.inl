@@ -172,8 +172,12 @@ namespace Json
 
 		template<typename WriterType>
 		bool WriteToJson(WriterType& Writer, FProperty* Prop, const void* Value);
+		template<typename WriterType>
+		bool WriteToJson(WriterType& Writer, const GMP::Serializer::Traits::FPropVisit& Visit, const void* Value);
 		template<typename JsonType>
 		bool ReadFromJson(const JsonType& JsonVal, FProperty* Prop, void* Value);
+		template<typename JsonType>
+		bool ReadFromJson(const JsonType& JsonVal, const GMP::Serializer::Traits::FPropVisit& Visit, void* Value);
 		namespace Internal
 		{
 			using namespace JsonUtils;
@@ -353,29 +357,12 @@ namespace Json
 				Data.ToJson(Writer);
 			}
 
-			inline FStringView GetAuthoredNameForField(FProperty* Prop, FStringBuilderBase& StrBuilder, bool bIsUserdefinedStruct)
+			inline FStringView GetAuthoredNameForField(const GMP::Serializer::Traits::FPropVisit& Visit, FStringBuilderBase& StrBuilder)
 			{
-				Prop->GetFName().ToString(StrBuilder);
-				FStringView NameView(StrBuilder.GetData(), StrBuilder.Len());
-				auto RetLen = StrBuilder.Len();
-				if (bIsUserdefinedStruct)
-				{
-					const int32 GuidStrLen = 32;
-					const int32 MinimalPostfixlen = GuidStrLen + 3;
-					if (NameView.Len() > MinimalPostfixlen)
-					{
-						auto TestView = NameView.LeftChop(GuidStrLen + 1);
-						int32 FirstCharToRemove = -1;
-						const bool bCharFound = TestView.FindLastChar(TCHAR('_'), FirstCharToRemove);
-						if (bCharFound && (FirstCharToRemove > 0))
-						{
-							NameView = TestView.Mid(0, FirstCharToRemove);
-							RetLen = FirstCharToRemove;
-						}
-					}
-				}
-				Serializer::FCaseFormatter::StandardizeCase(StrBuilder.GetData(), RetLen);
-				return NameView;
+				// the user defined struct postfix is stripped once when the visit plan is built
+				StrBuilder.Append(Visit.AuthoredString);
+				Serializer::FCaseFormatter::StandardizeCase(StrBuilder.GetData(), StrBuilder.Len());
+				return FStringView(StrBuilder.GetData(), StrBuilder.Len());
 			}
 
 			template<typename WriterType>
@@ -432,17 +419,13 @@ namespace Json
 				else
 				{
 					GMP_ENSURE_JSON(Writer.StartObject());
-					const bool bIsUserdefinedStruct = Struct->IsA(UUserDefinedStruct::StaticClass());
-					for (TFieldIterator<FProperty> It(Struct); It; ++It)
+					const auto Plan = GMP::Serializer::Traits::GetStructVisitPlan(Struct);
+					for (const GMP::Serializer::Traits::FPropVisit& Visit : Plan->Props)
 					{
-						if (It->HasAnyPropertyFlags(/*Writer.IgnoreFlags |*/ CPF_Deprecated | CPF_Transient | CPF_SkipSerialization | CPF_EditorOnly))
-							continue;
-
-						FProperty* SubProp = *It;
 						TStringBuilder<256> StrBuiler;
-						auto Name = GetAuthoredNameForField(SubProp, StrBuiler, bIsUserdefinedStruct);
+						auto Name = GetAuthoredNameForField(Visit, StrBuiler);
 						GMP_ENSURE_JSON(Writer.Key(Name.GetData(), Name.Len()));
-						WriteToJson(Writer, SubProp, StructAddr);
+						WriteToJson(Writer, Visit, StructAddr);
 					}
 
 					GMP_ENSURE_JSON(Writer.EndObject());
@@ -746,16 +729,12 @@ namespace Json
 				{
 					if (const bool bIsUserdefinedStruct = Struct->IsA(UUserDefinedStruct::StaticClass()))
 					{
-						for (TFieldIterator<FProperty> It(Struct); It; ++It)
+						const auto Plan = GMP::Serializer::Traits::GetStructVisitPlan(Struct);
+						for (const GMP::Serializer::Traits::FPropVisit& Visit : Plan->Props)
 						{
-							if (It->HasAnyPropertyFlags(CPF_Deprecated | CPF_Transient | CPF_SkipSerialization | CPF_EditorOnly))
-								continue;
-
-							FProperty* SubProp = *It;
-							auto OriginalName = GMP::Serializer::GetAuthoredFNameForField(SubProp->GetFName());
-							if (auto Val = JsonUtils::FindMember(JsonVal, OriginalName))
+							if (auto Val = JsonUtils::FindMember(JsonVal, Visit.AuthoredName))
 							{
-								ReadFromJson(*Val, SubProp, OutValue);
+								ReadFromJson(*Val, Visit, OutValue);
 							}
 						}
 					}
@@ -1248,9 +1227,10 @@ namespace Json
 					auto Value = Prop->template ContainerPtrToValuePtr<void>(Addr, 0);
 					GMP_ENSURE_JSON(Writer.StartArray());
 					FScriptArrayHelper Helper(Prop, Value);
+					const GMP::Serializer::Traits::FPropVisit InnerVisit{Prop->Inner, 0, GMP::Serializer::Traits::GetPropKind(Prop->Inner)};
 					for (int32 i = 0; i < Helper.Num(); ++i)
 					{
-						WriteToJson(Writer, Prop->Inner, ElemAsContainerBase(Prop->Inner, Helper.GetRawPtr(i)));
+						WriteToJson(Writer, InnerVisit, ElemAsContainerBase(Prop->Inner, Helper.GetRawPtr(i)));
 					}
 					GMP_ENSURE_JSON(Writer.EndArray());
 				}
@@ -1266,9 +1246,10 @@ namespace Json
 						auto ItemsToRead = FMath::Max((int32)JsonUtils::ArraySize(JsonVal), 0);
 						FScriptArrayHelper Helper(Prop, OutValue);
 						Helper.Resize(ItemsToRead);
+						const GMP::Serializer::Traits::FPropVisit InnerVisit{Prop->Inner, 0, GMP::Serializer::Traits::GetPropKind(Prop->Inner)};
 						for (auto i = 0; i < Helper.Num(); ++i)
 						{
-							ReadFromJson(JsonUtils::ArrayElm(JsonVal, i), Prop->Inner, ElemAsContainerBase(Prop->Inner, Helper.GetRawPtr(i)));
+							ReadFromJson(JsonUtils::ArrayElm(JsonVal, i), InnerVisit, ElemAsContainerBase(Prop->Inner, Helper.GetRawPtr(i)));
 						}
 					}
 					else
@@ -1427,6 +1408,16 @@ namespace Json
 		{
 			return GMP::Serializer::Traits::ForeachProp([](auto& InVal, auto* InProp, void* OutVal) -> bool { return Internal::TValueDispatcher<std::decay_t<decltype(*InProp)>>::Read(InVal, InProp, OutVal); }, JsonVal, Prop, Value);
 		}
+		template<typename WriterType>
+		bool WriteToJson(WriterType& Writer, const GMP::Serializer::Traits::FPropVisit& Visit, const void* Value)
+		{
+			return GMP::Serializer::Traits::ForeachProp([](auto& OutVal, auto* InProp, const void* InVal) -> bool { return Internal::TValueDispatcher<std::decay_t<decltype(*InProp)>>::Write(OutVal, InProp, InVal); }, Writer, Visit, Value);
+		}
+		template<typename JsonType>
+		bool ReadFromJson(const JsonType& JsonVal, const GMP::Serializer::Traits::FPropVisit& Visit, void* Value)
+		{
+			return GMP::Serializer::Traits::ForeachProp([](auto& InVal, auto* InProp, void* OutVal) -> bool { return Internal::TValueDispatcher<std::decay_t<decltype(*InProp)>>::Read(InVal, InProp, OutVal); }, JsonVal, Visit, Value);
+		}
 	}  // namespace Detail
 
 	template<typename WriterType, typename DataType>
@@ -0,0 +1,77 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "GMPSignalsImpl.h"
+#include "HAL/LowLevelMemTracker.h"
+
+// Memory accounting for the message hub.
+//
+// LLM: allocations are attributed to GMP/Signals (stores, listener elements and their callables),
+// GMP/Holders (retained store-message payloads) and GMP/Responses (pending request callbacks).
+// Console: gmp.mem.dump [N] prints totals plus the top keys by bytes and by listener count,
+//          gmp.mem.stale [Purge] lists (and optionally disconnects) listeners whose handler died without disconnect.
+#if UE_5_00_OR_LATER
+LLM_DECLARE_TAG_API(GMP, GMP_API);
+LLM_DECLARE_TAG_API(GMP_Signals, GMP_API);
+LLM_DECLARE_TAG_API(GMP_Holders, GMP_API);
+LLM_DECLARE_TAG_API(GMP_Responses, GMP_API);
+#define GMP_LLM_SCOPE(Tag) LLM_SCOPE_BYTAG(Tag)
+#else
+#define GMP_LLM_SCOPE(Tag)
+#endif
+
+namespace GMP
+{
+struct FGMPKeyMemory
+{
+	FName Key;
+	int32 Stores = 0;
+	int32 Listeners = 0;
+	int32 StaleListeners = 0;
+	int32 HeldMessages = 0;
+	SIZE_T StoreBytes = 0;
+	SIZE_T CallableBytes = 0;
+	SIZE_T HolderBytes = 0;
+
+	SIZE_T GetTotalBytes() const { return StoreBytes + HolderBytes; }
+};
+
+struct FGMPMemorySummary
+{
+	int32 Stores = 0;
+	int32 Listeners = 0;
+	int32 StaleListeners = 0;
+	int32 SourceMappings = 0;
+	int32 ExtKeys = 0;
+	int32 Responses = 0;
+	SIZE_T StoreBytes = 0;
+	SIZE_T CallableBytes = 0;
+	SIZE_T HolderBytes = 0;
+	SIZE_T MappingBytes = 0;
+	SIZE_T ResponseBytes = 0;
+
+	SIZE_T GetTotalBytes() const { return StoreBytes + HolderBytes + MappingBytes + ResponseBytes; }
+};
+
+struct FGMPStaleListener
+{
+	FName Key;
+	FGMPKey Id;
+	FSigSource Source;
+};
+
+GMP_API void GMPForEachSignalStore(TFunctionRef<void(FSignalStore&)> Func);
+// Bytes of the source->stores mappings and the ext-key sets, see FSigSource::SigSourceKey
+GMP_API SIZE_T GMPGetSourceMappingSize(int32* OutNumMappings = nullptr, int32* OutNumExtKeys = nullptr);
+
+namespace MemoryStats
+{
+	// Per message key, sorted by total bytes (descending). Sizes are approximations of the owned heap blocks.
+	GMP_API FGMPMemorySummary CollectKeyMemory(TArray<FGMPKeyMemory>& Out);
+	GMP_API int32 CollectStaleListeners(TArray<FGMPStaleListener>& Out);
+	GMP_API int32 PurgeStaleListeners();
+}  // namespace MemoryStats
+}  // namespace GMP
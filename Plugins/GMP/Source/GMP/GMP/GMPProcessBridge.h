@@ -0,0 +1,118 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Containers/Ticker.h"
+#include "GMP/GMPArchive.h"
+#include "GMP/GMPStruct.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
+
+// Local inter-process transport for GMP messages.
+//
+// Every participant owns one inbox ring living in a named shared memory region (GMPBridge_<Channel>_<Pid>).
+// The ring accepts any number of producers and exactly one consumer (the owner), so the host inbox is used as MPSC
+// and every sidecar inbox as SPSC. The host is discovered through FGMPProcessLock: whoever owns
+// Saved/GMPLocks/Bridge_<Channel>.lock is the host, sidecars read the PID from that file and say Hello.
+//
+// Topology is a star: sidecars only talk to the host, the host relays through its own message hub.
+//  - Subscribe(Key): peers start forwarding every local notification of Key to this process.
+//  - Publish(Key, ...): the message is sent to peers (the host to subscribed sidecars, a sidecar to the host) and
+//    is notified on the receiving hub, which in turn relays it to its own subscribers (the origin is never echoed).
+// Payloads are written with Serializer::TArgsSerializer<FArchive>, prefixed by the key and the parameter type names.
+class FGMPProcessLock;
+
+namespace GMP
+{
+namespace Bridge
+{
+	struct FRing;
+}
+
+enum class EGMPBridgeRole : uint8
+{
+	Auto,
+	Host,
+	Sidecar,
+};
+
+class GMP_API FGMPProcessBridge
+{
+public:
+	static FGMPProcessBridge& Get();
+
+	FGMPProcessBridge();
+	~FGMPProcessBridge();
+	FGMPProcessBridge(const FGMPProcessBridge&) = delete;
+	FGMPProcessBridge& operator=(const FGMPProcessBridge&) = delete;
+
+	// InboxSize is rounded up to a power of two, bAutoPump registers a core ticker which drains the inbox every frame
+	bool Start(const FString& InChannel, EGMPBridgeRole InRole = EGMPBridgeRole::Auto, uint32 InboxSize = 1024 * 1024, bool bAutoPump = true);
+	void Stop();
+
+	bool IsRunning() const { return !!Inbox; }
+	bool IsHost() const { return bIsHost; }
+	uint32 GetPid() const { return SelfPid; }
+	int32 GetPeerNum() const { return Peers.Num(); }
+	const FString& GetChannel() const { return Channel; }
+
+	bool Subscribe(const FName& Key);
+	void Unsubscribe(const FName& Key);
+
+	template<typename... TArgs>
+	bool Publish(const FName& Key, const TArgs&... Args)
+	{
+		TArray<uint8> Buffer;
+		FMemoryWriter Writer(Buffer);
+		FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+		WriteMessageHeader(Ar, Key, FMessageBody::MakeStaticNamesImpl<TArgs...>());
+		Serializer::TArgsSerializer<FArchive>::SerializeArgs(Ar, std::make_index_sequence<sizeof...(TArgs)>{}, const_cast<TArgs&>(Args)...);
+		return PublishPayload(Key, Buffer);
+	}
+
+	// Types may be null for registered message keys
+	bool PublishRaw(const FName& Key, const FGMPTypedAddr* Addrs, int32 Num, const FName* Types = nullptr);
+
+	// Drains the inbox and returns the number of handled records, MaxRecords <= 0 means unbounded
+	int32 Pump(int32 MaxRecords = 0);
+
+	static FString GetLockFilePath(const FString& InChannel);
+
+private:
+	struct FPeer;
+	struct FRoute
+	{
+		FGMPKey ListenKey;
+		TArray<uint32> Subscribers;
+	};
+
+	static void WriteMessageHeader(FArchive& Ar, const FName& Key, TArrayView<const FName> Types);
+	bool PublishPayload(const FName& Key, const TArray<uint8>& Payload);
+
+	FPeer* ConnectPeer(uint32 Pid);
+	void DisconnectPeer(uint32 Pid);
+	bool SendTo(FPeer& Peer, uint16 Kind, const TArray<uint8>& Payload);
+	void HandleRecord(uint16 Kind, uint32 SenderPid, const uint8* Data, int32 Size);
+	void DispatchPublish(uint32 SenderPid, const uint8* Data, int32 Size);
+	void AddSubscriber(const FName& Key, uint32 Pid);
+	void RemoveSubscriber(const FName& Key, uint32 Pid);
+	void ForwardLocal(const FName& Key, const FGMPTypedAddr* Addrs, int32 Num, const FName* Types);
+	bool Tick(float DeltaTime);
+
+	TUniquePtr<Bridge::FRing> Inbox;
+	TMap<uint32, TUniquePtr<FPeer>> Peers;
+	TMap<FName, FRoute> Routes;
+	TSet<FName> LocalSubscriptions;
+	TUniquePtr<FGMPProcessLock> HostLock;
+	FTSTicker::FDelegateHandle TickerHandle;
+	TWeakObjectPtr<UObject> Listener;
+	FString Channel;
+	uint32 SelfPid = 0;
+	uint32 HostPid = 0;
+	uint32 DispatchingPid = 0;
+	double NextLivenessCheck = 0.0;
+	bool bIsHost = false;
+};
+}  // namespace GMP
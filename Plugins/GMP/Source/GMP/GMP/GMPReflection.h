@@ -76,6 +76,11 @@ namespace Reflection
 	// Property --> Name
 	GMP_API FName GetPropertyName(const FProperty* Property, bool bExactType = true);
 	GMP_API FName GetPropertyName(const FProperty* Property, EGMPPropertyClass PropertyType, EGMPPropertyClass ElemPropType = PropertyTypeInvalid, EGMPPropertyClass KeyPropType = PropertyTypeInvalid);
+	// Names above are cached per property, this fills the calling thread's cache for every property of InStruct up front
+	GMP_API void WarmupPropertyNames(const UStruct* InStruct);
+	// Changes whenever fields may have been destroyed or replaced (GC, reinstancing, hot reload), caches keyed by field or
+	// function addresses drop their entries when it moves
+	GMP_API uint32 GetFieldEpoch();
 	inline bool EqualPropertyPair(const FProperty* Lhs, const FProperty* Rhs, bool bExactType = true)
 	{
 		GMP_CHECK_SLOW(Lhs && Rhs);
@@ -51,10 +51,16 @@ protected:
 #endif
 			{
 				FGMPNetBitWriter Writer(Package, 0);
-				Serializer::NetSerializeWithProps(Package, Writer, Properties, ((std::remove_cv_t<TArgs>&)InArgs)...);
+				{
+					// unions may delta encode against the connection shadow, which relies on in-order delivery
+					FUnionNetDeltaScope DeltaScope(Package, bReliable);
+					Serializer::NetSerializeWithProps(Package, Writer, Properties, ((std::remove_cv_t<TArgs>&)InArgs)...);
+				}
 				ensureWorld(PC, Writer.GetNumBits() <= GetMaxBytes() * 8);
 				if (ensureAlways(!Writer.IsError()))
 					PostRPCMsg(PC, Sender, MessageKey.ToString(), const_cast<TArray<uint8>&>(*Writer.GetBuffer()), bReliable);
+				else
+					ResetUnionNetShadow(Package);
 			}
 		}
 	}
@@ -21,61 +21,106 @@ namespace Serializer
 
 	namespace Traits
 	{
-		template<typename Lambda, typename SrcType, typename ValType>
-		struct TForEachPropOperation
+		// Serializer-relevant property kinds, resolved by exact field class (FSoftClassProperty folds into SoftObject)
+		enum class EPropKind : uint8
+		{
+			Other,
+			Struct,
+			Array,
+			Set,
+			Map,
+			Str,
+			Name,
+			Text,
+			Bool,
+			Enum,
+			Int8,
+			Int16,
+			Int,
+			Int64,
+			Byte,
+			UInt16,
+			UInt32,
+			UInt64,
+			Float,
+			Double,
+			SoftObject,
+		};
+		GMP_API EPropKind GetPropKind(const FProperty* Property);
+
+		struct FPropVisit
 		{
-		protected:
-			Lambda Op;
-			TMap<uint64, TUniqueFunction<bool(SrcType&, FProperty*, ValType*)>> DispatchMap;
+			FProperty* Property = nullptr;
+			EPropKind Kind = EPropKind::Other;
+			// field name without the user defined struct "_Index_Guid" postfix, as a case-insensitive lookup key
+			FName AuthoredName;
+			// the same name with its authored casing, FName may hand back the casing another name registered first
+			FString AuthoredString;
+		};
+
+		// Flattened serializable fields of a struct (super chain included, CPF_Deprecated/Transient/SkipSerialization/EditorOnly skipped).
+		// Built once per struct layout and rebuilt when a user defined struct is recompiled, all plans are dropped after GC/reinstancing.
+		struct FStructVisitPlan
+		{
+			const FField* LayoutHead = nullptr;
+			int32 LayoutSize = 0;
+			bool bUserDefined = false;
+			TArray<FPropVisit> Props;
+			TMap<FName, int32> AuthoredIndex;
 
-		public:
-			TForEachPropOperation(Lambda InOp)
-				: Op(InOp)
+			const FPropVisit* FindByAuthoredName(FName Name) const
 			{
-#define INSERT_PROP_IMPL(TestType, ImplType) DispatchMap.Emplace(TestType::StaticClassCastFlags(), [this](SrcType& Src, FProperty* Prop, ValType* Value) { return Op(Src, CastFieldChecked<ImplType>(Prop), Value); });
-#define INSERT_PROP(TYPE) INSERT_PROP_IMPL(TYPE, TYPE)
-				INSERT_PROP(FStructProperty)
-				INSERT_PROP(FArrayProperty)
-				INSERT_PROP(FSetProperty)
-				INSERT_PROP(FMapProperty)
-				INSERT_PROP(FStrProperty)
-				INSERT_PROP(FNameProperty)
-				INSERT_PROP(FTextProperty)
-				INSERT_PROP(FBoolProperty)
-				INSERT_PROP(FEnumProperty)
-				INSERT_PROP(FInt8Property)
-				INSERT_PROP(FInt16Property)
-				INSERT_PROP(FIntProperty)
-				INSERT_PROP(FInt64Property)
-				INSERT_PROP(FByteProperty)
-				INSERT_PROP(FUInt16Property)
-				INSERT_PROP(FUInt32Property)
-				INSERT_PROP(FUInt64Property)
-				INSERT_PROP(FFloatProperty)
-				INSERT_PROP(FDoubleProperty)
-				INSERT_PROP_IMPL(FSoftObjectProperty, FSoftObjectProperty)
-				INSERT_PROP_IMPL(FSoftClassProperty, FSoftObjectProperty)
-#undef INSERT_PROP_IMPL
-#undef INSERT_PROP
+				auto Find = AuthoredIndex.Find(Name);
+				return Find ? &Props[*Find] : nullptr;
 			}
+		};
+		using FStructVisitPlanRef = TSharedRef<const FStructVisitPlan, ESPMode::ThreadSafe>;
+		GMP_API FStructVisitPlanRef GetStructVisitPlan(const UStruct* Struct);
+		GMP_API void InvalidateStructVisitPlan(const UStruct* Struct);
 
-			bool operator()(SrcType& Src, FProperty* Property, ValType* Value) const
+		template<typename Lambda, typename SrcType, typename ValType>
+		FORCEINLINE bool DispatchProp(Lambda&& Op, SrcType& Src, FProperty* Property, EPropKind Kind, ValType* Value)
+		{
+			switch (Kind)
 			{
-				if (auto Find = DispatchMap.Find(Property->GetCastFlags()))
-				{
-					return (*Find)(Src, Property, Value);
-				}
-				else
-				{
+#define GMP_DISPATCH_PROP(KIND, TYPE) \
+	case EPropKind::KIND:           \
+		return Op(Src, static_cast<TYPE*>(Property), Value);
+				GMP_DISPATCH_PROP(Struct, FStructProperty)
+				GMP_DISPATCH_PROP(Array, FArrayProperty)
+				GMP_DISPATCH_PROP(Set, FSetProperty)
+				GMP_DISPATCH_PROP(Map, FMapProperty)
+				GMP_DISPATCH_PROP(Str, FStrProperty)
+				GMP_DISPATCH_PROP(Name, FNameProperty)
+				GMP_DISPATCH_PROP(Text, FTextProperty)
+				GMP_DISPATCH_PROP(Bool, FBoolProperty)
+				GMP_DISPATCH_PROP(Enum, FEnumProperty)
+				GMP_DISPATCH_PROP(Int8, FInt8Property)
+				GMP_DISPATCH_PROP(Int16, FInt16Property)
+				GMP_DISPATCH_PROP(Int, FIntProperty)
+				GMP_DISPATCH_PROP(Int64, FInt64Property)
+				GMP_DISPATCH_PROP(Byte, FByteProperty)
+				GMP_DISPATCH_PROP(UInt16, FUInt16Property)
+				GMP_DISPATCH_PROP(UInt32, FUInt32Property)
+				GMP_DISPATCH_PROP(UInt64, FUInt64Property)
+				GMP_DISPATCH_PROP(Float, FFloatProperty)
+				GMP_DISPATCH_PROP(Double, FDoubleProperty)
+				GMP_DISPATCH_PROP(SoftObject, FSoftObjectProperty)
+#undef GMP_DISPATCH_PROP
+				default:
 					return Op(Src, Property, Value);
-				}
 			}
-		};
+		}
+
+		template<typename Lambda, typename SrcType, typename ValType>
+		FORCEINLINE bool ForeachProp(Lambda&& Op, SrcType& Src, FProperty* Property, ValType* Value)
+		{
+			return DispatchProp(std::forward<Lambda>(Op), Src, Property, GetPropKind(Property), Value);
+		}
 		template<typename Lambda, typename SrcType, typename ValType>
-		auto ForeachProp(Lambda&& Op, SrcType& Src, FProperty* Property, ValType* Value)
+		FORCEINLINE bool ForeachProp(Lambda&& Op, SrcType& Src, const FPropVisit& Visit, ValType* Value)
 		{
-			static const TForEachPropOperation<Lambda, SrcType, ValType> ForEach{std::forward<Lambda>(Op)};
-			return ForEach(Src, Property, Value);
+			return DispatchProp(std::forward<Lambda>(Op), Src, Visit.Property, Visit.Kind, Value);
 		}
 	}  // namespace Traits
 
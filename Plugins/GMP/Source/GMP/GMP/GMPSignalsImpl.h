@@ -6,6 +6,7 @@
 
 #include "Algo/AnyOf.h"
 #include "GMPSignals.inl"
+#include "GMPTrace.h"
 #include "Logging/LogMacros.h"
 #include "Misc/AssertionMacros.h"
 #include "Misc/ScopeExit.h"
@@ -241,6 +242,12 @@ public:
 	ArrayT GetKeysBySrc(FSigSource InSigSrc, bool bIncludeNoSrc = true) const;
 
 	TArray<FGMPKey> GetKeysByHandler(const UObject* InHandler) const;
+	// Listeners whose handler object died without disconnecting, they linger until this store fires again
+	TArray<FGMPKey> GetStaleKeys() const;
+	int32 PurgeStaleKeys();
+	int32 GetListenerNum() const;
+	// Approximate bytes held by the element array, the elements and their heap-allocated callables
+	SIZE_T GetAllocatedSize(SIZE_T* OutCallableBytes = nullptr) const;
 	bool IsAlive(const UObject* InHandler, FSigSource InSigSrc) const;
 	bool IsAlive(FGMPKey Key) const;
 	bool IsAlive() const;
@@ -315,7 +322,10 @@ public:
 			bool bShouldErase = !Elem->IsInvokable();
 			if (!bShouldErase)
 			{
-				GMPInvokeRaw(Elem, a0, a1);
+				{
+					GMP_TRACE_LISTENER_SCOPE(MessageKey, Elem);
+					GMPInvokeRaw(Elem, a0, a1);
+				}
 				bShouldErase = !Elem->TestTimes();
 			}
 			if (bShouldErase)
@@ -347,6 +357,15 @@ public:
 #if GMP_WITH_DIRECT_SIGNAL && !GMP_WITH_STATIC_STORE
 	struct FStaticSignalSlot* OwnerSlot = nullptr;
 #endif
+#if GMP_WITH_DYNAMIC_CALL_CHECK
+	// sender type lists that already passed the signature check on this key, see FMessageHub::IsSignatureCompatibleCached
+	struct FSigCheckMemo
+	{
+		const void* SenderTypes;
+		uint32 Epoch;
+	};
+	TArray<FSigCheckMemo, TInlineAllocator<2>> SigCheckMemo;
+#endif
 };
 
 #if !GMP_WITH_STATIC_STORE
@@ -513,6 +532,40 @@ GMP_API void GMPFireWithSigSourceDirectRaw(FSignalStore* RawStore, FSigSource In
 #endif
 #endif
 
+// gmp.ShareBPSendArgs, Blueprint listeners of one send share its argument list and signature checks (GMPBPLib.cpp)
+extern GMP_API int32 GGMPShareBPSendArgs;
+// drops the shared Blueprint arguments, called when the outermost tracked send on the game thread returns
+void ResetBPSendArgs();
+// how often Blueprint listeners had to build shared arguments, for tests
+uint32 GetBPSendArgsBuilds();
+
+// Brackets one delivery to message listeners. Only tracked while gmp.ShareBPSendArgs is on, then the arguments shared
+// for the send in flight are dropped once the outermost tracked delivery returns, so a later send can never be mistaken for it.
+struct GMP_API FMessageSendScope
+{
+	FMessageSendScope()
+		: bTracked(!!GGMPShareBPSendArgs)
+	{
+		if (bTracked)
+			Enter();
+	}
+	~FMessageSendScope()
+	{
+		if (bTracked)
+			Leave();
+	}
+	FMessageSendScope(const FMessageSendScope&) = delete;
+	FMessageSendScope& operator=(const FMessageSendScope&) = delete;
+
+	// whether a tracked delivery is in flight on this thread
+	static bool IsTracking();
+
+private:
+	static void Enter();
+	static void Leave();
+	bool bTracked;
+};
+
 template<bool bAllowDuplicate, typename... TArgs>
 class TSignal final : public FSignalImpl
 {
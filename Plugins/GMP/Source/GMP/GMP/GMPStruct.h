@@ -132,6 +132,9 @@ public:
 	uint64 Value = 0;
 
 #if GMP_WITH_TYPENAME
+	// Not swapped for a FNameSuccession::GetTypeId id: Value aligns the struct to 8 bytes, so an int32 id pads back to the
+	// same 16 bytes wherever an FName is 8 (builds without WITH_CASE_PRESERVING_NAME), and every reader of the name would
+	// pay a registry lookup to get it back.
 	FName TypeName;
 #endif
 
@@ -426,6 +429,7 @@ public:
 	template<typename C, typename A>
 	static auto& FromHolderArray(TArray<FGMPTypedAddr, C>& Ret, const A& Arr)
 	{
+		Ret.Reserve(Ret.Num() + Arr.Num());
 		for (auto& Holder : Arr)
 		{
 			Ret.Emplace(Holder.GetAddr()
@@ -487,6 +491,23 @@ namespace GMP
 using FTypedAddresses = TArray<FGMPTypedAddr, TInlineAllocator<8>>;
 using FArrayTypeNames = TArray<FName, TInlineAllocator<8>>;
 
+// A plain TArray<FGMPTypedAddr> for the places that cannot take FTypedAddresses (a Blueprint `UPARAM(ref)` array, a
+// dynamic delegate argument). It is borrowed from a per-thread pool and handed back emptied with its capacity kept,
+// so repeated sends do not allocate. Nested sends borrow distinct arrays.
+struct GMP_API FPooledTypedAddrArray
+{
+	FPooledTypedAddrArray();
+	~FPooledTypedAddrArray();
+	FPooledTypedAddrArray(const FPooledTypedAddrArray&) = delete;
+	FPooledTypedAddrArray& operator=(const FPooledTypedAddrArray&) = delete;
+
+	TArray<FGMPTypedAddr>& Get() const { return *Arr; }
+	TArray<FGMPTypedAddr>* operator->() const { return Arr; }
+
+private:
+	TArray<FGMPTypedAddr>* Arr;
+};
+
 struct FGMPExtra
 {
 	int32 Size = 0;
@@ -554,10 +575,11 @@ struct GMP_API FMessageBody : public FGMPExtra
 
 	bool IsSignatureCompatible(bool bCall, const FArrayTypeNames*& OldTypes);
 
-	TArray<FGMPTypedAddr> MakeFullParameters(uint8 BodyDataMask, int32& ReserveCnt, TArray<FGMPTypedAddr>& InOutAddrs) const
+	// inline up to 8 entries, InOutAddrs backs the BP-visible parameter array (see FPooledTypedAddrArray)
+	FTypedAddresses MakeFullParameters(uint8 BodyDataMask, int32& ReserveCnt, TArray<FGMPTypedAddr>& InOutAddrs) const
 	{
-		TArray<FGMPTypedAddr> Ret;
-		Ret.Reserve(Size + 4);
+		FTypedAddresses Ret;
+		Ret.Reserve(Size + FMath::CountBits(BodyDataMask & 0xf));
 
 		if (BodyDataMask & (1 << 0))
 		{
@@ -0,0 +1,131 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "GMPMacros.h"
+#include "Trace/Trace.h"
+
+// Per-send dispatch cost attribution.
+//
+// Two consumers share the same scopes:
+//  - the "GMP" trace channel (enable with -trace=gmp or `Trace.Enable GMP`) emits GMP.MessageKey / GMP.Send / GMP.Listener
+//    events, which Unreal Insights shows in the generic event tables and can be aggregated offline;
+//  - the in-process aggregator (`gmp.trace.stats 1`, then `gmp.trace.dump`) which ranks hot keys and slow listeners live.
+// When both are off every scope costs one predictable branch.
+#if !defined(GMP_WITH_TRACE_CHANNEL)
+#define GMP_WITH_TRACE_CHANNEL (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+#endif
+
+#if GMP_WITH_TRACE_CHANNEL
+UE_TRACE_CHANNEL_EXTERN(GMPChannel, GMP_API)
+
+namespace GMP
+{
+struct FSigSource;
+class FSigElm;
+namespace Trace
+{
+	extern GMP_API int32 GGMPTraceStats;
+
+	FORCEINLINE bool IsActive() { return !!GGMPTraceStats || UE_TRACE_CHANNELEXPR_IS_ENABLED(GMPChannel); }
+
+	enum class ESourceKind : uint8
+	{
+		None,
+		Object,
+		Signal,
+		External,
+		ExtKey,
+		Any,
+	};
+
+	struct FKeyStats
+	{
+		FName Key;
+		uint64 Sends = 0;
+		uint64 Listeners = 0;
+		uint64 Cycles = 0;
+		uint64 MaxCycles = 0;
+		uint64 PayloadBytes = 0;
+	};
+
+	struct FListenerStats
+	{
+		FName Key;
+		FString Handler;
+		uint64 HandlerId = 0;
+		uint64 Calls = 0;
+		uint64 Cycles = 0;
+		uint64 MaxCycles = 0;
+	};
+
+	// Snapshots of the in-process aggregator, sorted by accumulated cycles (descending)
+	GMP_API void GetKeyStats(TArray<FKeyStats>& Out);
+	GMP_API void GetListenerStats(TArray<FListenerStats>& Out);
+	GMP_API void ResetStats();
+
+	class GMP_API FSendScope
+	{
+	public:
+		FORCEINLINE FSendScope(const FName& Key, const FSigSource& InSigSrc, int32 NumParams, const FName* TypeNames)
+		{
+			if (IsActive())
+				Begin(Key, InSigSrc, NumParams, TypeNames);
+		}
+		FORCEINLINE ~FSendScope()
+		{
+			if (StartCycle)
+				End();
+		}
+		FSendScope(const FSendScope&) = delete;
+		FSendScope& operator=(const FSendScope&) = delete;
+
+	private:
+		friend class FListenerScope;
+		void Begin(const FName& Key, const FSigSource& InSigSrc, int32 NumParams, const FName* TypeNames);
+		void End();
+
+		FName MessageKey;
+		FSendScope* Outer = nullptr;
+		uint64 StartCycle = 0;
+		uint32 ListenerCount = 0;
+		uint32 PayloadBytes = 0;
+		uint16 ParamCount = 0;
+		ESourceKind SourceKind = ESourceKind::None;
+	};
+
+	class GMP_API FListenerScope
+	{
+	public:
+		FORCEINLINE FListenerScope(const FName& StoreKey, const FSigElm* Elem)
+		{
+			if (IsActive())
+				Begin(StoreKey, Elem);
+		}
+		FORCEINLINE ~FListenerScope()
+		{
+			if (StartCycle)
+				End();
+		}
+		FListenerScope(const FListenerScope&) = delete;
+		FListenerScope& operator=(const FListenerScope&) = delete;
+
+	private:
+		void Begin(const FName& StoreKey, const FSigElm* Elem);
+		void End();
+
+		const FSigElm* SigElm = nullptr;
+		FName MessageKey;
+		uint64 StartCycle = 0;
+	};
+}  // namespace Trace
+}  // namespace GMP
+
+#define GMP_TRACE_SEND_SCOPE(Key, SigSrc, NumParams, TypeNames) GMP::Trace::FSendScope PREPROCESSOR_JOIN(GMPTraceSend_, __LINE__)(Key, SigSrc, NumParams, TypeNames)
+#define GMP_TRACE_LISTENER_SCOPE(StoreKey, Elem) GMP::Trace::FListenerScope PREPROCESSOR_JOIN(GMPTraceListener_, __LINE__)(StoreKey, Elem)
+#else
+#define GMP_TRACE_SEND_SCOPE(Key, SigSrc, NumParams, TypeNames)
+#define GMP_TRACE_LISTENER_SCOPE(StoreKey, Elem)
+#endif
@@ -42,6 +42,51 @@ namespace WorldLocals
 	template<template<typename> class C, typename U, typename T>
 	C<TWorldLocalSharedPair<U, T>> TSharedStorage;
 
+	// Dense per-world index used to address world local storage directly, 0 stands for the null world.
+	// A world gets its index on first use and gives it back on world cleanup or tear down, after every registered cleanup ran for it.
+	// Indices of worlds collected without either are reclaimed after GC. A world already cleaned up never gets a new index,
+	// it shares RetiredWorldIndex until it initializes again, that slot is cleared after every GC.
+	constexpr int32 RetiredWorldIndex = 1;
+	GMP_API int32 GetWorldIndex(const UWorld* InWorld, bool bAdd = true);
+	GMP_API void AddWorldIndexCleanup(void (*InFunc)(int32 WorldIndex));
+
+	template<typename U, typename S>
+	auto& FindOrAddIndexed(U* InCtx, S& Container)
+	{
+		const int32 Idx = GetWorldIndex(InCtx);
+		if (Idx >= Container.Num())
+			Container.SetNum(Idx + 1);
+
+		auto& Ref = Container[Idx];
+		if (Ref.WeakCtx.Get() != InCtx)
+		{
+			// left over by a world which went away without cleanup
+			Ref = {};
+			if (IsValid(InCtx))
+				Ref.WeakCtx = InCtx;
+		}
+		return Ref.Object;
+	}
+	template<typename U, typename S>
+	auto FindIndexed(U* InCtx, S& Container) -> decltype(Container[0].Object.Get())
+	{
+		const int32 Idx = GetWorldIndex(InCtx, false);
+		if (Container.IsValidIndex(Idx) && Container[Idx].WeakCtx.Get() == InCtx)
+			return Container[Idx].Object.Get();
+		return nullptr;
+	}
+	template<typename U, typename S>
+	bool RemoveIndexed(U* InCtx, S& Container)
+	{
+		const int32 Idx = GetWorldIndex(InCtx, false);
+		if (Container.IsValidIndex(Idx) && Container[Idx].WeakCtx.Get() == InCtx && Container[Idx].Object.IsValid())
+		{
+			Container[Idx] = {};
+			return true;
+		}
+		return false;
+	}
+
 	template<typename U, typename S>
 	auto& FindOrAdd(U* InCtx, S& Container)
 	{
@@ -123,6 +168,16 @@ namespace WorldLocals
 		GMP_CHECK(!IsGarbageCollecting() && (!InCtx || IsValid(InCtx)));
 		return Find(InCtx, Container);
 	}
+	template<typename U, typename S, typename F>
+	auto& GetIndexedLocalVal(U* InCtx, S& Container, const F& Ctor)
+	{
+		GMP_CHECK(!IsGarbageCollecting() && (!InCtx || IsValid(InCtx)));
+		auto& Ptr = FindOrAddIndexed(InCtx, Container);
+		if (!Ptr.IsValid())
+			Ctor(Ptr, InCtx);
+		GMP_CHECK(Ptr.IsValid());
+		return *Ptr.Get();
+	}
 
 	template<typename T>
 	struct TLocalHolder
@@ -216,6 +271,27 @@ namespace WorldLocals
 	struct TLocalOpsImpl
 	{
 		using S = std::conditional_t<std::is_same<U, UGameInstance>::value, UGameInstance, std::conditional_t<std::is_same<U, ULocalPlayer>::value, ULocalPlayer, UWorld>>;
+		// world locals are addressed by world index instead of scanning the per-context pairs
+		static constexpr bool bWorldIndexed = std::is_same<S, UWorld>::value && std::is_same<C<int32>, TArray<int32, TInlineAllocator<4>>>::value;
+
+		template<typename T>
+		static void BindIndexCleanup()
+		{
+			if (TrueOnFirstCall([] {}))
+			{
+				AddWorldIndexCleanup([](int32 WorldIndex) {
+					auto& Container = GetStorage<T>();
+					if (Container.IsValidIndex(WorldIndex))
+						Container[WorldIndex] = {};
+				});
+#if WITH_EDITOR
+				if (GIsEditor)
+				{
+					BindEditorEndDelegate(TDelegate<void(const bool)>::CreateLambda([](const bool) { GetStorage<T>().Empty(4); }));
+				}
+#endif
+			}
+		}
 
 		template<typename T>
 		static void BindCleanup()
@@ -249,21 +325,41 @@ namespace WorldLocals
 		template<typename T, typename F>
 		static std::enable_if_t<std::is_base_of<UObject, T>::value, T*> LocalObject(const UObject* WorldContextObj, const F& ObjCtor)
 		{
-			return &GetLocalVal<S>(GetUObject(WorldContextObj), GetStorage<T>(), [&](auto& Ptr, auto* Ctx) {
+			auto Ctor = [&](auto& Ptr, auto* Ctx) {
 				GMP_CLOG(WITH_EDITOR, TEXT("Allocating local object %s in %s"), ITS::TypeWStr<T>(), *GetNameSafe(Ctx));
 				auto Obj = ObjCtor();
 				Ptr = Obj;
 				AddObjectReference(Ctx, Obj);
-			});
+			};
+			if constexpr (bWorldIndexed)
+			{
+				BindIndexCleanup<T>();
+				return &GetIndexedLocalVal(GetUObject(WorldContextObj), GetStorage<T>(), Ctor);
+			}
+			else
+			{
+				return &GetLocalVal<S>(GetUObject(WorldContextObj), GetStorage<T>(), Ctor);
+			}
 		}
 		template<typename T, typename F>
 		static std::enable_if_t<!std::is_base_of<UObject, T>::value, T*> LocalObject(const UObject* WorldContextObj, const F& SharedCtor)
 		{
-			return &GetLocalVal<S>(GetUObject(WorldContextObj), GetStorage<T>(), [&](auto& Ref, auto* Ctx) {
-				GMP_CLOG(WITH_EDITOR, TEXT("Allocating shared object %s in %s"), ITS::TypeWStr<T>(), *GetNameSafe(Ctx));
-				Ref = SharedCtor();
-				BindCleanup<T>();
-			});
+			if constexpr (bWorldIndexed)
+			{
+				BindIndexCleanup<T>();
+				return &GetIndexedLocalVal(GetUObject(WorldContextObj), GetStorage<T>(), [&](auto& Ref, auto* Ctx) {
+					GMP_CLOG(WITH_EDITOR, TEXT("Allocating shared object %s in %s"), ITS::TypeWStr<T>(), *GetNameSafe(Ctx));
+					Ref = SharedCtor();
+				});
+			}
+			else
+			{
+				return &GetLocalVal<S>(GetUObject(WorldContextObj), GetStorage<T>(), [&](auto& Ref, auto* Ctx) {
+					GMP_CLOG(WITH_EDITOR, TEXT("Allocating shared object %s in %s"), ITS::TypeWStr<T>(), *GetNameSafe(Ctx));
+					Ref = SharedCtor();
+					BindCleanup<T>();
+				});
+			}
 		}
 
 		template<typename T>
@@ -284,13 +380,19 @@ namespace WorldLocals
 		template<typename T>
 		static bool RemoveLocal(const UObject* WorldContextObj)
 		{
-			return RemoveLocalVal<S>(GetUObject(WorldContextObj), GetStorage<T>());
+			if constexpr (bWorldIndexed)
+				return RemoveIndexed(GetUObject(WorldContextObj), GetStorage<T>());
+			else
+				return RemoveLocalVal<S>(GetUObject(WorldContextObj), GetStorage<T>());
 		}
 
 		template<typename T>
 		static T* LocalPtr(const UObject* WorldContextObj)
 		{
-			return FindLocalVal<S>(GetUObject(WorldContextObj), GetStorage<T>());
+			if constexpr (bWorldIndexed)
+				return FindIndexed(GetUObject(WorldContextObj), GetStorage<T>());
+			else
+				return FindLocalVal<S>(GetUObject(WorldContextObj), GetStorage<T>());
 		}
 
 		template<typename T, typename F>
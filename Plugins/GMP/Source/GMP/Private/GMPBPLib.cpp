@@ -1,6 +1,7 @@
 ﻿//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
 
 #include "GMPBPLib.h"
+#include "GMPBPFastCall.h"
 
 #include "CoreUObject.h"
 
@@ -23,7 +24,9 @@
 #include "UObject/UObjectThreadContext.h"
 #include "UObject/UnrealType.h"
 #include "UnrealCompatibility.h"
+#include "Misc/DelayedAutoRegister.h"
 #include "Misc/ExpressionParser.h"
+#include "Hash/CityHash.h"
 
 #if WITH_EDITOR
 #include "UnrealEd.h"
@@ -43,6 +46,11 @@ static FXConsoleVariableRef CVarGMPUseFastCallPath(
 	GGMPUseFastCallPath,
 	TEXT("Enable FastCall path for GMP Listen callbacks (0=off, 1=on). Default: on when UE_BLUEPRINT_EVENTGRAPH_FASTCALLS is enabled."));
 
+static FXConsoleVariableRef CVarGMPShareBPSendArgs(
+	TEXT("gmp.ShareBPSendArgs"),
+	GMP::GGMPShareBPSendArgs,
+	TEXT("Share the argument list and signature validation of one send across all of its Blueprint listeners (0=off, 1=on). Each listener still gets its own parameter frame."));
+
 //////////////////////////////////////////////////////////////////////////
 DEFINE_LOG_CATEGORY(LogGMP);
 namespace GMP
@@ -52,8 +60,12 @@ void GMPTraceEnterBP(const FString& MsgStr, FString&& Loc);
 void GMPTraceLeaveBP(const FString& MsgStr);
 struct FGMPTraceBPGuard
 {
-	FGMPTraceBPGuard(const FString& MsgStr)
-		: KeyRef(MsgStr)
+	FGMPTraceBPGuard(const FName& MsgKey)
+		: FGMPTraceBPGuard(MsgKey.ToString())
+	{
+	}
+	FGMPTraceBPGuard(FString MsgStr)
+		: KeyRef(MoveTemp(MsgStr))
 	{
 		TStringBuilder<1024> Loc;
 #if DO_BLUEPRINT_GUARD
@@ -69,12 +81,13 @@ struct FGMPTraceBPGuard
 		GMPTraceEnterBP(KeyRef, Loc.ToString());
 	}
 	~FGMPTraceBPGuard() { GMPTraceLeaveBP(KeyRef); }
-	const FString& KeyRef;
+	FString KeyRef;
 };
 #else
 struct FGMPTraceBPGuard
 {
 	FGMPTraceBPGuard(const FString& MsgStr) {}
+	FGMPTraceBPGuard(const FName& MsgKey) {}
 	~FGMPTraceBPGuard() {}
 };
 #endif
@@ -177,9 +190,11 @@ int32 GetPropertyCustomIndex(FProperty* Property)
 	return -1;
 }
 
-template<typename A>
-FORCEINLINE bool BPLibNotifyMessage(const FString& MessageId, const FGMPObjNamePair& SigPair, A& Params, uint8 Type, UGMPManager* Mgr)
+// K is either the FString key of the older nodes or the interned FName literal, converted once into FMSGKEY below
+template<typename K, typename A>
+FORCEINLINE bool BPLibNotifyMessage(const K& InMessageId, const FGMPObjNamePair& SigPair, A& Params, uint8 Type, UGMPManager* Mgr)
 {
+	const FMSGKEY MessageId(InMessageId);
 	do
 	{
 		GMP::FGMPTraceBPGuard Guard(MessageId);
@@ -328,6 +343,286 @@ void DestroyFunctionParameters(UFunction* Function, void* p)
 		It->DestroyValue_InContainer(p);
 	}
 }
+
+namespace FrameCopy
+{
+	// Parameter layout of a UFunction resolved once, instead of walking the field chain and querying property traits per message.
+	// Shared by the message frame copies and CallObjectFunctionByName, the latter also calls functions with a return value.
+	struct FPlan
+	{
+		struct FParam
+		{
+			FProperty* Prop = nullptr;
+			int32 Offset = 0;
+			int32 Size = 0;
+			bool bPod = false;
+			// copied bytewise to and from script VM values as well (bools and object pointers convert on their way)
+			bool bScriptPod = false;
+			bool bInput = false;
+			bool bOutput = false;
+#if GMP_WITH_DYNAMIC_TYPE_CHECK
+			FName TypeName;
+#endif
+		};
+		TWeakObjectPtr<UFunction> Function;
+		TArray<FParam, TInlineAllocator<8>> Params;
+		// adjacent zero constructed params merged into [Offset, Size) runs, the rest need their constructor/destructor to run
+		TArray<TPair<int32, int32>, TInlineAllocator<4>> ZeroRuns;
+		TArray<FProperty*, TInlineAllocator<4>> CtorParams;
+		TArray<FProperty*, TInlineAllocator<4>> DtorParams;
+		int32 ParmsSize = -1;
+		// message frames only, false when the function has a return value
+		bool bValid = false;
+
+		void Build(UFunction* InFunc)
+		{
+			Function = InFunc;
+			ParmsSize = InFunc->ParmsSize;
+			bValid = true;
+			bool bLastZero = false;
+			for (TFieldIterator<FProperty> It(InFunc); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+			{
+				FProperty* Prop = *It;
+				const bool bReturn = Prop->HasAnyPropertyFlags(CPF_ReturnParm);
+				if (bReturn)
+					bValid = false;
+
+				FParam& Param = Params.AddDefaulted_GetRef();
+				Param.Prop = Prop;
+				Param.Offset = Prop->GetOffset_ForUFunction();
+				Param.Size = GMP::GetElementSize(Prop) * Prop->ArrayDim;
+				// bitfield bools can not be copied bytewise
+				auto BoolProp = CastField<FBoolProperty>(Prop);
+				Param.bPod = Prop->HasAnyPropertyFlags(CPF_IsPlainOldData) && (!BoolProp || BoolProp->IsNativeBool());
+				Param.bScriptPod = Prop->HasAnyPropertyFlags(CPF_IsPlainOldData) && !BoolProp && !Prop->IsA<FObjectPropertyBase>();
+				// same direction rule as UK2Node_CallFunction::CreatePinsForFunctionCall
+				Param.bInput = !bReturn && (!Prop->HasAnyPropertyFlags(CPF_OutParm) || Prop->HasAnyPropertyFlags(CPF_ReferenceParm));
+				Param.bOutput = bReturn || (Prop->HasAnyPropertyFlags(CPF_OutParm) && !Prop->HasAnyPropertyFlags(CPF_ConstParm));
+#if GMP_WITH_DYNAMIC_TYPE_CHECK
+				Param.TypeName = Reflection::GetPropertyName(Prop, true);
+#endif
+				if (Prop->HasAnyPropertyFlags(CPF_ZeroConstructor))
+				{
+					// the padding in between belongs to the frame as well
+					if (bLastZero)
+						ZeroRuns.Last().Value = Param.Offset + Param.Size - ZeroRuns.Last().Key;
+					else
+						ZeroRuns.Emplace(Param.Offset, Param.Size);
+				}
+				else
+				{
+					CtorParams.Add(Prop);
+				}
+				bLastZero = Prop->HasAnyPropertyFlags(CPF_ZeroConstructor);
+
+				if (!Prop->HasAnyPropertyFlags(CPF_NoDestructor))
+					DtorParams.Add(Prop);
+			}
+		}
+
+		void Initialize(void* FramePtr) const
+		{
+			for (auto& Run : ZeroRuns)
+				FMemory::Memzero(static_cast<uint8*>(FramePtr) + Run.Key, Run.Value);
+			for (auto Prop : CtorParams)
+				Prop->InitializeValue_InContainer(FramePtr);
+		}
+
+		void Destroy(void* FramePtr) const
+		{
+			for (auto Prop : DtorParams)
+				Prop->DestroyValue_InContainer(FramePtr);
+		}
+	};
+
+	// Game thread callers share the cached plan, other threads build an uncached one into Scratch.
+	// Callers running script in between pass OutPin: ProcessEvent may re-enter FindPlan or run a GC that drops the cache.
+	static const FPlan& FindPlan(UFunction* Function, FPlan& Scratch, TSharedPtr<const FPlan>* OutPin = nullptr)
+	{
+		if (!Function)
+			return Scratch;
+		if (!IsInGameThread())
+		{
+			Scratch.Build(Function);
+			return Scratch;
+		}
+
+		// dropped on the field epoch, before a destroyed function's plan could be looked up again
+		static TMap<const UFunction*, TSharedRef<FPlan>> Plans;
+		static uint32 PlansEpoch = ~0u;
+		const uint32 CurEpoch = Reflection::GetFieldEpoch();
+		if (PlansEpoch != CurEpoch)
+		{
+			Plans.Empty();
+			PlansEpoch = CurEpoch;
+		}
+
+		TSharedRef<FPlan>* Find = Plans.Find(Function);
+		// the address may have been reused by another function, or a blueprint recompiled in place
+		if (!Find || (*Find)->Function.Get() != Function || (*Find)->ParmsSize != Function->ParmsSize)
+		{
+			TSharedRef<FPlan> Plan = MakeShared<FPlan>();
+			Plan->Build(Function);
+			Find = &Plans.Add(Function, Plan);
+		}
+		if (OutPin)
+			*OutPin = *Find;
+		return **Find;
+	}
+}  // namespace FrameCopy
+
+namespace FastCall
+{
+	static std::atomic<FEligibilityTable*> Tables{nullptr};
+
+	void RegisterEligibilityTable(FEligibilityTable* Table)
+	{
+		FEligibilityTable* Head = Tables.load(std::memory_order_relaxed);
+		do
+		{
+			Table->Next = Head;
+		} while (!Tables.compare_exchange_weak(Head, Table, std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	static void ResetTables()
+	{
+		for (FEligibilityTable* Table = Tables.load(std::memory_order_acquire); Table; Table = Table->Next)
+			Table->Reset();
+	}
+
+	static FDelayedAutoRegisterHelper DelayBindReset(EDelayedRegisterRunPhase::StartOfEnginePreInit, [] {
+		FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&ResetTables);
+#if WITH_EDITOR && UE_5_00_OR_LATER
+		FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([](const auto&) { ResetTables(); });
+#endif
+#if UE_5_00_OR_LATER
+		FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason) { ResetTables(); });
+#endif
+	});
+
+	// Native sends into blueprint listeners: when the function has no return value and every parameter is plain old data,
+	// the message arguments are written straight into the invoked frame instead of a parameter block copied into it.
+	static bool IsDirectFrameEligible(UFunction* Function)
+	{
+		static FEligibilityTable Cache;
+		return Cache.FindOrAdd(Function, [Function] {
+			if (Function->HasAnyFunctionFlags(FUNC_UbergraphFunction))
+				return false;
+			FrameCopy::FPlan Scratch;
+			auto& Plan = FrameCopy::FindPlan(Function, Scratch);
+			if (!Plan.bValid)
+				return false;
+			for (auto& Param : Plan.Params)
+			{
+				if (!Param.bPod)
+					return false;
+			}
+			return true;
+		});
+	}
+}  // namespace FastCall
+
+namespace BPSendArgs
+{
+	// What every Blueprint listener of one send derives from the message alike: the full argument list (body data
+	// included) and which listener functions already passed the signature check. Game thread only, cleared when the
+	// outermost tracked send returns (FMessageSendScope).
+	struct FSendArgs
+	{
+		const FMessageBody* Body = nullptr;
+		FSigSource Sender = FSigSource(nullptr);
+		FGMPKey Seq;
+		FName Key;
+		const FGMPTypedAddr* Source = nullptr;
+		int32 Size = -1;
+		uint8 BodyDataMask = 0;
+
+		// MakeFullParameters points the sender at one shared static, a nested send would overwrite it
+		const UObject* SigSource = nullptr;
+		FTypedAddresses Params;
+		TArray<FGMPTypedAddr> InnerArr;
+		int32 OutCnt = 0;
+		TArray<const UFunction*, TInlineAllocator<4>> Validated;
+
+		bool Matches(const FMessageBody& Msg, uint8 InBodyDataMask) const
+		{
+			const auto MsgParams = Msg.GetParams();
+			return Body == &Msg && Sender == Msg.Source && Seq == Msg.Sequence() && Key == Msg.MessageKey() && Source == MsgParams.GetData() && Size == MsgParams.Num()
+				   && BodyDataMask == InBodyDataMask;
+		}
+
+		void Build(const FMessageBody& Msg, uint8 InBodyDataMask)
+		{
+			const auto MsgParams = Msg.GetParams();
+			Body = &Msg;
+			Sender = Msg.Source;
+			Seq = Msg.Sequence();
+			Key = Msg.MessageKey();
+			Source = MsgParams.GetData();
+			Size = MsgParams.Num();
+			BodyDataMask = InBodyDataMask;
+			Validated.Reset();
+
+			OutCnt = 0;
+			Params = Msg.MakeFullParameters(BodyDataMask, OutCnt, InnerArr);
+			if (BodyDataMask & (1 << 0))
+			{
+				SigSource = Msg.GetSigSource();
+				Params[0] = FGMPTypedAddr::MakeMsg(SigSource);
+			}
+		}
+
+		void Clear()
+		{
+			Body = nullptr;
+			Sender = FSigSource(nullptr);
+			Seq = {};
+			Key = NAME_None;
+			Source = nullptr;
+			Size = -1;
+			SigSource = nullptr;
+			Params.Reset();
+			InnerArr.Reset();
+			OutCnt = 0;
+			Validated.Reset();
+		}
+	};
+
+	// one entry per nesting level, a send from inside a listener does not evict the arguments of the send around it
+	static TArray<TUniquePtr<FSendArgs>> Levels;
+	static int32 Depth = 0;
+	static uint32 Builds = 0;
+
+	static FSendArgs& Enter(const FMessageBody& Msg, uint8 BodyDataMask)
+	{
+		if (Levels.Num() <= Depth)
+			Levels.Add(MakeUnique<FSendArgs>());
+		FSendArgs& Args = *Levels[Depth++];
+		if (!Args.Matches(Msg, BodyDataMask))
+		{
+			Args.Build(Msg, BodyDataMask);
+			++Builds;
+		}
+		return Args;
+	}
+	static void Leave() { --Depth; }
+}  // namespace BPSendArgs
+
+void ResetBPSendArgs()
+{
+	if (!IsInGameThread() || BPSendArgs::Depth != 0)
+		return;
+	for (auto& Args : BPSendArgs::Levels)
+	{
+		if (Args->Size >= 0)
+			Args->Clear();
+	}
+}
+
+uint32 GetBPSendArgsBuilds()
+{
+	return BPSendArgs::Builds;
+}
 #define GMP_LOG_BP_INVOKE (!UE_BUILD_SHIPPING)
 #if GMP_LOG_BP_INVOKE
 static bool bLogGMPBPExecution = false;
@@ -442,8 +737,7 @@ DEFINE_FUNCTION(UGMPBPLib::execResponseMessageVariadic)
 FGMPTypedAddr UGMPBPLib::ListenMessageByKey(FName MessageKey, const FGMPScriptDelegate& Delegate, int32 Times, int32 Order, uint8 Type, UGMPManager* Mgr, const FGMPObjNamePair& SigPair)
 {
 #if GMP_TRACE_MSG_STACK
-	FString MsgStr = MessageKey.ToString();
-	GMP::FGMPTraceBPGuard Guard(MsgStr);
+	GMP::FGMPTraceBPGuard Guard(MessageKey);
 #endif
 	using namespace GMP;
 
@@ -499,8 +793,9 @@ FGMPTypedAddr UGMPBPLib::ListenMessageByKey(FName MessageKey, const FGMPScriptDe
 #if GMP_LOG_BP_INVOKE
 														GMP_CLOG(bLogGMPBPExecution, TEXT("Execute %s"), *Delegate.ToString<UObject>());
 #endif
-														TArray<FGMPTypedAddr> Arr(paddrs, extra->Size);
-														Delegate.ExecuteIfBound(extra->Source.TryGetUObject(), extra->Key, extra->Seq, Arr);
+														FPooledTypedAddrArray Arr;
+														Arr->Append(paddrs, extra->Size);
+														Delegate.ExecuteIfBound(extra->Source.TryGetUObject(), extra->Key, extra->Seq, Arr.Get());
 													},
 													{Times, Order});
 #else
@@ -511,8 +806,9 @@ FGMPTypedAddr UGMPBPLib::ListenMessageByKey(FName MessageKey, const FGMPScriptDe
 #if GMP_LOG_BP_INVOKE
 														GMP_CLOG(bLogGMPBPExecution, TEXT("Execute %s"), *Delegate.ToString<UObject>());
 #endif
-														auto Arr = Msg.Parameters();
-														Delegate.ExecuteIfBound(Msg.GetSigSource(), Msg.MessageKey(), Msg.Sequence(), Arr);
+														FPooledTypedAddrArray Arr;
+														Arr->Append(Msg.GetParams().GetData(), Msg.GetParamCount());
+														Delegate.ExecuteIfBound(Msg.GetSigSource(), Msg.MessageKey(), Msg.Sequence(), Arr.Get());
 													},
 													{Times, Order});
 #endif
@@ -544,8 +840,7 @@ FGMPTypedAddr UGMPBPLib::ListenMessageByKeyValidate(const TArray<FName>& ArgName
 FGMPTypedAddr UGMPBPLib::ListenMessageViaKey(UObject* Listener, FName MessageKey, FName EventName, int32 Times, int32 Order, uint8 Type, uint8 BodyDataMask, UGMPManager* Mgr, const FGMPObjNamePair& SigPair, int64 ParmBitMask)
 {
 #if GMP_TRACE_MSG_STACK
-	FString MsgStr = MessageKey.ToString();
-	GMP::FGMPTraceBPGuard Guard(MsgStr);
+	GMP::FGMPTraceBPGuard Guard(MessageKey);
 #endif
 	using namespace GMP;
 	FGMPTypedAddr ret;
@@ -562,6 +857,7 @@ FGMPTypedAddr UGMPBPLib::ListenMessageViaKey(UObject* Listener, FName MessageKey
 			FFrame::KismetExecutionMessage(TEXT("Event Is Invalid"), ELogVerbosity::Error);
 			break;
 		}
+		Reflection::WarmupPropertyNames(Function);
 
 		auto NetMode = World->GetNetMode();
 		if (EnumHasAllFlags((EMessageAuthorityType)Type, EMessageTypeBoth))
@@ -687,41 +983,62 @@ FGMPTypedAddr UGMPBPLib::ListenMessageViaKey(UObject* Listener, FName MessageKey
 
 				// Standard CallMessageFunction path
 				int32 OutCnt = 0;
-				TArray<FGMPTypedAddr> InnerArr;
-				auto Params = Msg.MakeFullParameters(BodyDataMask, OutCnt, InnerArr);
+				FPooledTypedAddrArray InnerArr;
+				FTypedAddresses LocalParams;
+				BPSendArgs::FSendArgs* Shared = nullptr;
+				if (GGMPShareBPSendArgs && IsInGameThread() && FMessageSendScope::IsTracking())
+				{
+					Shared = &BPSendArgs::Enter(Msg, BodyDataMask);
+					OutCnt = Shared->OutCnt;
+				}
+				else
+				{
+					LocalParams = Msg.MakeFullParameters(BodyDataMask, OutCnt, InnerArr.Get());
+				}
+				ON_SCOPE_EXIT
+				{
+					if (Shared)
+						BPSendArgs::Leave();
+				};
+				const FTypedAddresses& Params = Shared ? Shared->Params : LocalParams;
 #if GMP_LOG_BP_INVOKE
 				GMP_CLOG(bLogGMPBPExecution, TEXT("Execute %s.%s"), *GetNameSafe(Listener), *Function->GetName());
 #endif
 #if GMP_WITH_DYNAMIC_CALL_CHECK
-				int32 PropIdx = 0;
-				for (TFieldIterator<FProperty> PropIt(Function); PropIt; ++PropIt)
+				if (!Shared || !Shared->Validated.Contains(Function))
 				{
-					const bool bIsInput = !(PropIt->HasAnyPropertyFlags(CPF_ReturnParm) || (PropIt->HasAnyPropertyFlags(CPF_OutParm) && !PropIt->HasAnyPropertyFlags(CPF_ReferenceParm) && !PropIt->HasAnyPropertyFlags(CPF_ConstParm)));
-					if (!ensureWorld(Listener, bIsInput && Params.IsValidIndex(PropIdx)))
-						return;
-
-					if (PropIdx >= OutCnt)
+					int32 PropIdx = 0;
+					for (TFieldIterator<FProperty> PropIt(Function); PropIt; ++PropIt)
 					{
-						UEnum* EnumPtr = nullptr;
-						auto ByteProp = CastField<FByteProperty>(*PropIt);
-						if (ByteProp)
-						{
-							EnumPtr = ByteProp->GetIntPropertyEnum();
-						}
-						else if (auto EnumProp = CastField<FEnumProperty>(*PropIt))
-						{
-							ByteProp = CastField<FByteProperty>(EnumProp->GetUnderlyingProperty());
-							ensureWorld(Listener, ByteProp || EnumProp->GetUnderlyingProperty()->IsEnum());
-							EnumPtr = EnumProp->GetEnum();
-						}
+						const bool bIsInput = !(PropIt->HasAnyPropertyFlags(CPF_ReturnParm) || (PropIt->HasAnyPropertyFlags(CPF_OutParm) && !PropIt->HasAnyPropertyFlags(CPF_ReferenceParm) && !PropIt->HasAnyPropertyFlags(CPF_ConstParm)));
+						if (!ensureWorld(Listener, bIsInput && Params.IsValidIndex(PropIdx)))
+							return;
 
-						if (EnumPtr)
+						if (PropIdx >= OutCnt)
 						{
-							ensureWorld(Listener, EnumPtr->GetCppForm() == UEnum::ECppForm::EnumClass);
-							ensureWorld(Listener, Params[PropIdx].TypeName == TClass2Name<uint8>::GetFName() || Params[PropIdx].TypeName == Class2Name::TTraitsEnumBase::GetFName(EnumPtr, 1) || Params[PropIdx].TypeName == *EnumPtr->CppType);
+							UEnum* EnumPtr = nullptr;
+							auto ByteProp = CastField<FByteProperty>(*PropIt);
+							if (ByteProp)
+							{
+								EnumPtr = ByteProp->GetIntPropertyEnum();
+							}
+							else if (auto EnumProp = CastField<FEnumProperty>(*PropIt))
+							{
+								ByteProp = CastField<FByteProperty>(EnumProp->GetUnderlyingProperty());
+								ensureWorld(Listener, ByteProp || EnumProp->GetUnderlyingProperty()->IsEnum());
+								EnumPtr = EnumProp->GetEnum();
+							}
+
+							if (EnumPtr)
+							{
+								ensureWorld(Listener, EnumPtr->GetCppForm() == UEnum::ECppForm::EnumClass);
+								ensureWorld(Listener, Params[PropIdx].TypeName == TClass2Name<uint8>::GetFName() || Params[PropIdx].TypeName == Class2Name::TTraitsEnumBase::GetFName(EnumPtr, 1) || Params[PropIdx].TypeName == *EnumPtr->CppType);
+							}
 						}
+						++PropIdx;
 					}
-					++PropIdx;
+					if (Shared)
+						Shared->Validated.Add(Function);
 				}
 #endif
 				const uint64 WritebackFlags = ParmBitMask ? (ParmBitMask << OutCnt) : 0;
@@ -1078,41 +1395,291 @@ bool UGMPBPLib::ResolveMemberChain(void* Container, UStruct* ContainerType, cons
 	return false;
 }
 
-DEFINE_FUNCTION(UGMPBPLib::execGetMemberByChain)
+namespace GMP
 {
-	using namespace GMP;
-	P_GET_OBJECT(UObject, InObject);
-	P_GET_TARRAY_REF(FName, Chain);
+namespace MemberChain
+{
+	// A chain compiles into runs of struct hops ending at an object hop or the leaf. A run only depends on the type it
+	// starts from, so it is cached per (type, chain, start index) as one offset; object hops still follow the runtime
+	// subobject class into the next run. Game thread only, dropped whenever fields may have changed.
+	enum class EHop : uint8
+	{
+		Leaf,
+		Object,
+		Weak,
+		Soft,
+	};
 
-	// Step into the wildcard OutValue pin to capture the downstream's real FProperty + write address.
-	Stack.MostRecentProperty = nullptr;
-	Stack.MostRecentPropertyAddress = nullptr;
-	Stack.StepCompiledIn<FProperty>(nullptr);
-	FProperty* OutProperty = CastField<FProperty>(Stack.MostRecentProperty);
-	void* OutPtr = Stack.MostRecentPropertyAddress;
+	struct FRun
+	{
+		TArray<FName, TInlineAllocator<4>> Chain;
+		FProperty* Prop = nullptr;
+		const FProperty* VerifiedOut = nullptr;
+		int32 Offset = 0;
+		int32 EndIndex = 0;
+		EHop Hop = EHop::Leaf;
+	};
 
-	P_FINISH
+	struct FParsedChain
+	{
+		TArray<FName, TInlineAllocator<4>> Chain;
+		uint32 Hash = 0;
+	};
 
-	P_NATIVE_BEGIN
+	using FRunKey = TTuple<const UStruct*, uint32, int32>;
+	static TMap<FRunKey, FRun> Runs;
+	static TMap<FName, FParsedChain> ParsedChains;
+
+	static uint32 HashChain(TArrayView<const FName> Chain)
+	{
+		uint32 Hash = 0;
+		for (auto& Name : Chain)
+			Hash = HashCombine(Hash, GetTypeHash(Name));
+		return Hash;
+	}
+
+	static bool IsSameChain(TArrayView<const FName> Lhs, TArrayView<const FName> Rhs)
+	{
+		if (Lhs.Num() != Rhs.Num())
+			return false;
+		for (int32 i = 0; i < Lhs.Num(); ++i)
+		{
+			if (Lhs[i] != Rhs[i])
+				return false;
+		}
+		return true;
+	}
+
+	static void Reset() { Runs.Empty(); }
+
+	static FRun* FindOrAddRun(UStruct* StartType, TArrayView<const FName> Chain, uint32 Hash, int32 StartIndex)
+	{
+		// nothing left to resolve, there is no leaf to build a run for
+		if (StartIndex >= Chain.Num())
+			return nullptr;
+
+		if (TrueOnFirstCall([] {}))
+		{
+			FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&Reset);
+#if WITH_EDITOR && UE_5_00_OR_LATER
+			FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([](const auto&) { Reset(); });
+#endif
+		}
+
+		const FRunKey Key{StartType, Hash, StartIndex};
+		if (FRun* Find = Runs.Find(Key))
+		{
+			if (IsSameChain(Find->Chain, Chain))
+				return Find;
+		}
+
+		FRun Run;
+		UStruct* CurType = StartType;
+		for (int32 i = StartIndex; i < Chain.Num(); ++i)
+		{
+			const FName MemberName = Chain[i];
+			FProperty* Prop = FindFProperty<FProperty>(CurType, MemberName);
+			if (!Prop)
+			{
+				FFrame::KismetExecutionMessage(*FString::Printf(TEXT("GMPMemberChain: member '%s' not found on '%s'"), *MemberName.ToString(), *CurType->GetName()),
+											   ELogVerbosity::Warning,
+											   TEXT("GMPMemberChain"));
+				return nullptr;
+			}
+			Run.Offset += Prop->GetOffset_ForInternal();
+			Run.Prop = Prop;
+			Run.EndIndex = i;
+
+			if (i == Chain.Num() - 1)
+			{
+				Run.Hop = EHop::Leaf;
+				break;
+			}
+			if (CastField<FObjectProperty>(Prop))
+			{
+				Run.Hop = EHop::Object;
+				break;
+			}
+			if (CastField<FWeakObjectProperty>(Prop))
+			{
+				Run.Hop = EHop::Weak;
+				break;
+			}
+			if (CastField<FSoftObjectProperty>(Prop))
+			{
+				Run.Hop = EHop::Soft;
+				break;
+			}
+			if (auto* StructProp = CastField<FStructProperty>(Prop))
+			{
+				CurType = StructProp->Struct;
+				continue;
+			}
+
+			FFrame::KismetExecutionMessage(*FString::Printf(TEXT("GMPMemberChain: member '%s' is a leaf and cannot be descended"), *MemberName.ToString()),
+										   ELogVerbosity::Warning,
+										   TEXT("GMPMemberChain"));
+			return nullptr;
+		}
+		if (!Run.Prop)
+			return nullptr;
+		Run.Chain.Append(Chain.GetData(), Chain.Num());
+		return &Runs.Add(Key, MoveTemp(Run));
+	}
+
+	// cached counterpart of UGMPBPLib::ResolveMemberChain, also hands out the run of the leaf
+	static FRun* Resolve(UObject* InObject, TArrayView<const FName> Chain, uint32 Hash, void*& OutAddr)
+	{
+		void* CurAddr = InObject;
+		UStruct* CurType = InObject->GetClass();
+		int32 Index = 0;
+		while (FRun* Run = FindOrAddRun(CurType, Chain, Hash, Index))
+		{
+			void* ValueAddr = static_cast<uint8*>(CurAddr) + Run->Offset;
+			UObject* SubObj = nullptr;
+			switch (Run->Hop)
+			{
+				case EHop::Leaf:
+					OutAddr = ValueAddr;
+					return Run;
+				case EHop::Object:
+					SubObj = static_cast<FObjectProperty*>(Run->Prop)->GetObjectPropertyValue(ValueAddr);
+					if (!SubObj)
+						FFrame::KismetExecutionMessage(*FString::Printf(TEXT("GMPMemberChain: null object at '%s'"), *Chain[Run->EndIndex].ToString()), ELogVerbosity::Warning, TEXT("GMPMemberChain"));
+					break;
+				case EHop::Weak:
+					SubObj = static_cast<FWeakObjectProperty*>(Run->Prop)->GetPropertyValue(ValueAddr).Get();
+					break;
+				case EHop::Soft:
+					SubObj = static_cast<FSoftObjectProperty*>(Run->Prop)->GetPropertyValue(ValueAddr).Get();  // do not force-load; weak by design
+					break;
+			}
+			if (!SubObj)
+				return nullptr;
+			CurAddr = SubObj;
+			CurType = SubObj->GetClass();
+			Index = Run->EndIndex + 1;
+		}
+		return nullptr;
+	}
+
+	static const FParsedChain& ParseChainName(FName ChainName)
+	{
+		if (auto Find = ParsedChains.Find(ChainName))
+			return *Find;
+
+		TArray<FString> Parts;
+		ChainName.ToString().ParseIntoArray(Parts, TEXT("."));
+		FParsedChain Parsed;
+		for (auto& Part : Parts)
+			Parsed.Chain.Add(FName(*Part));
+		Parsed.Hash = HashChain(Parsed.Chain);
+		return ParsedChains.Add(ChainName, MoveTemp(Parsed));
+	}
+}  // namespace MemberChain
+}  // namespace GMP
+
+static bool GetMemberByChainImpl(UObject* InObject, TArrayView<const FName> Chain, uint32 ChainHash, FProperty* OutProperty, void* OutPtr)
+{
+	using namespace GMP;
 	if (!InObject || !OutProperty || !OutPtr)
 	{
 		FFrame::KismetExecutionMessage(TEXT("GMPMemberChain: null object/output"), ELogVerbosity::Warning, TEXT("GMPMemberChain"));
-		return;
+		return false;
+	}
+	if (Chain.Num() == 0)
+	{
+		FFrame::KismetExecutionMessage(TEXT("GMPMemberChain: empty chain"), ELogVerbosity::Warning, TEXT("GMPMemberChain"));
+		return false;
 	}
 
 	void* SrcAddr = nullptr;
 	FProperty* SrcProp = nullptr;
-	if (!ResolveMemberChain(InObject, InObject->GetClass(), Chain, SrcAddr, SrcProp) || !SrcAddr || !SrcProp)
-		return;  // ResolveMemberChain already logged; leave OutValue at default.
+	MemberChain::FRun* Run = nullptr;
+	if (IsInGameThread())
+	{
+		Run = MemberChain::Resolve(InObject, Chain, ChainHash, SrcAddr);
+		if (!Run)
+			return false;  // already logged; leave OutValue at default.
+		SrcProp = Run->Prop;
+		// the output pin of a call site is stable, compare types once per leaf and pin
+		if (Run->VerifiedOut == OutProperty)
+		{
+			OutProperty->CopyCompleteValueToScriptVM(OutPtr, SrcAddr);
+			return true;
+		}
+	}
+	else if (!UGMPBPLib::ResolveMemberChain(InObject, InObject->GetClass(), TArray<FName>(Chain.GetData(), Chain.Num()), SrcAddr, SrcProp) || !SrcAddr || !SrcProp)
+	{
+		return false;  // ResolveMemberChain already logged; leave OutValue at default.
+	}
 
 	if (!SrcProp->SameType(OutProperty))
 	{
 		FFrame::KismetExecutionMessage(*FString::Printf(TEXT("GMPMemberChain: leaf '%s' type mismatch with output pin"), *SrcProp->GetName()),
 									   ELogVerbosity::Warning,
 									   TEXT("GMPMemberChain"));
-		return;
+		return false;
 	}
+	if (Run)
+		Run->VerifiedOut = OutProperty;
 	OutProperty->CopyCompleteValueToScriptVM(OutPtr, SrcAddr);
+	return true;
+}
+
+bool UGMPBPLib::CopyMemberByChainName(UObject* InObject, FName ChainName, FProperty* OutProperty, void* OutPtr)
+{
+	using namespace GMP;
+	if (IsInGameThread())
+	{
+		auto& Parsed = MemberChain::ParseChainName(ChainName);
+		return GetMemberByChainImpl(InObject, Parsed.Chain, Parsed.Hash, OutProperty, OutPtr);
+	}
+
+	TArray<FString> Parts;
+	ChainName.ToString().ParseIntoArray(Parts, TEXT("."));
+	TArray<FName> Chain;
+	for (auto& Part : Parts)
+		Chain.Add(FName(*Part));
+	return GetMemberByChainImpl(InObject, Chain, 0, OutProperty, OutPtr);
+}
+
+DEFINE_FUNCTION(UGMPBPLib::execGetMemberByChain)
+{
+	using namespace GMP;
+	P_GET_OBJECT(UObject, InObject);
+	P_GET_TARRAY_REF(FName, Chain);
+
+	// Step into the wildcard OutValue pin to capture the downstream's real FProperty + write address.
+	Stack.MostRecentProperty = nullptr;
+	Stack.MostRecentPropertyAddress = nullptr;
+	Stack.StepCompiledIn<FProperty>(nullptr);
+	FProperty* OutProperty = CastField<FProperty>(Stack.MostRecentProperty);
+	void* OutPtr = Stack.MostRecentPropertyAddress;
+
+	P_FINISH
+
+	P_NATIVE_BEGIN
+	GetMemberByChainImpl(InObject, Chain, MemberChain::HashChain(Chain), OutProperty, OutPtr);
+	P_NATIVE_END
+}
+
+DEFINE_FUNCTION(UGMPBPLib::execGetMemberByChainName)
+{
+	using namespace GMP;
+	P_GET_OBJECT(UObject, InObject);
+	P_GET_PROPERTY(FNameProperty, ChainName);
+
+	Stack.MostRecentProperty = nullptr;
+	Stack.MostRecentPropertyAddress = nullptr;
+	Stack.StepCompiledIn<FProperty>(nullptr);
+	FProperty* OutProperty = CastField<FProperty>(Stack.MostRecentProperty);
+	void* OutPtr = Stack.MostRecentPropertyAddress;
+
+	P_FINISH
+
+	P_NATIVE_BEGIN
+	CopyMemberByChainName(InObject, ChainName, OutProperty, OutPtr);
 	P_NATIVE_END
 }
 
@@ -1161,6 +1728,50 @@ DEFINE_FUNCTION(UGMPBPLib::execNotifyMessageByKeyVariadic)
 	execNotifyMessageByKeyVariadicGet(Stack, RESULT_PARAM);
 }
 
+bool execNotifyMessageByNameVariadicGet(FFrame& Stack, RESULT_DECL)
+{
+	using namespace GMP;
+	P_GET_PROPERTY(FNameProperty, MessageId);
+	P_GET_STRUCT_REF(FGMPObjNamePair, SigSource);
+	P_GET_PROPERTY(FByteProperty, Type);
+	P_GET_OBJECT(UGMPManager, Mgr);
+
+#if !GMP_WITH_VARIADIC_SUPPORT
+	FFrame::KismetExecutionMessage(TEXT("version not supported"), ELogVerbosity::Error, TEXT("version not supported"));
+	P_FINISH
+	return false;
+#else
+
+	FGMPPropStackRefArray Params;
+	while (Stack.PeekCode() != EX_EndFunctionParms)
+	{
+		Stack.MostRecentPropertyAddress = nullptr;
+		Stack.MostRecentProperty = nullptr;
+		Stack.StepCompiledIn<FProperty>(nullptr);
+
+#if GMP_DEBUGGAME
+		ensureAlways(Stack.MostRecentProperty && Stack.MostRecentPropertyAddress);
+#endif
+
+		Params.Emplace(Stack.MostRecentPropertyAddress, Stack.MostRecentProperty);
+	}
+	P_FINISH
+
+	P_NATIVE_BEGIN
+	return BPLibNotifyMessage(MessageId, SigSource, Params, Type, Mgr);
+	P_NATIVE_END
+#endif
+}
+
+DEFINE_FUNCTION(UGMPBPLib::execNotifyMessageByNameVariadicRet)
+{
+	*(bool*)RESULT_PARAM = execNotifyMessageByNameVariadicGet(Stack, RESULT_PARAM);
+}
+DEFINE_FUNCTION(UGMPBPLib::execNotifyMessageByNameVariadic)
+{
+	execNotifyMessageByNameVariadicGet(Stack, RESULT_PARAM);
+}
+
 DEFINE_FUNCTION(UGMPBPLib::execAddrFromVariadic)
 {
 	using namespace GMP;
@@ -1439,25 +2050,19 @@ DEFINE_FUNCTION(UGMPBPLib::execAddrToSet)
 
 bool UGMPBPLib::MessageToArchive(FArchive& Ar, UFunction* Function, const TArray<FGMPTypedAddr>& Params, UPackageMap* PackageMap)
 {
+	using namespace GMP;
 	GMP_CHECK(Ar.IsSaving());
-	bool bSucc = true;
-	int32 Index = 0;
-	for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
-	{
-		if (It->HasAnyPropertyFlags(CPF_ReturnParm) || !Params.IsValidIndex(Index))
-		{
-			bSucc = false;
-			break;
-		}
+	FrameCopy::FPlan Scratch;
+	auto& Plan = FrameCopy::FindPlan(Function, Scratch);
+	if (!Plan.bValid || Params.Num() < Plan.Params.Num())
+		return false;
 
-		if (!NetSerializeProperty(Ar, *It, Params[Index].ToAddr(), PackageMap))
-		{
-			bSucc = false;
-			break;
-		}
-		++Index;
+	for (int32 Index = 0; Index < Plan.Params.Num(); ++Index)
+	{
+		if (!NetSerializeProperty(Ar, Plan.Params[Index].Prop, Params[Index].ToAddr(), PackageMap))
+			return false;
 	}
-	return bSucc;
+	return true;
 }
 
 bool UGMPBPLib::ArchiveToFrame(FArchive& ArToLoad, UFunction* Function, void* FramePtr, UPackageMap* PackageMap)
@@ -1466,62 +2071,56 @@ bool UGMPBPLib::ArchiveToFrame(FArchive& ArToLoad, UFunction* Function, void* Fr
 
 	GMP_CHECK(ArToLoad.IsLoading());
 
-	if (InitializeFunctionParameters(Function, FramePtr) < 0)
+	FrameCopy::FPlan Scratch;
+	auto& Plan = FrameCopy::FindPlan(Function, Scratch);
+	if (!Plan.bValid)
 		return false;
 
-	bool bSucc = true;
-	int32 Index = 0;
-	for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+	Plan.Initialize(FramePtr);
+	for (auto& Param : Plan.Params)
 	{
-		if (It->HasAnyPropertyFlags(CPF_ReturnParm))
-		{
-			bSucc = false;
-			break;
-		}
-		FProperty* Prop = *It;
-		if (!NetSerializeProperty(ArToLoad, Prop, Prop->ContainerPtrToValuePtr<void>(FramePtr), PackageMap))
+		if (!NetSerializeProperty(ArToLoad, Param.Prop, static_cast<uint8*>(FramePtr) + Param.Offset, PackageMap))
 		{
-			bSucc = false;
-			break;
+			Plan.Destroy(FramePtr);
+			return false;
 		}
-		++Index;
 	}
-	if (!bSucc)
-		DestroyFunctionParameters(Function, FramePtr);
-	return bSucc;
+	return true;
 }
 
 bool UGMPBPLib::MessageToFrame(UFunction* Function, void* FramePtr, TArrayView<const FGMPTypedAddr> Params)
 {
 	using namespace GMP;
-	if (InitializeFunctionParameters(Function, FramePtr) < 0)
+	FrameCopy::FPlan Scratch;
+	auto& Plan = FrameCopy::FindPlan(Function, Scratch);
+	if (!Plan.bValid || !ensure(Params.Num() >= Plan.Params.Num()))
 		return false;
 
-	bool bSucc = true;
-	int32 Index = 0;
-	for (TFieldIterator<FProperty> It(Function); It && It->HasAnyPropertyFlags(CPF_Parm); ++It)
+#if GMP_WITH_DYNAMIC_TYPE_CHECK
+	// validate before touching the frame, nothing needs to be destroyed on mismatch
+	for (int32 Index = 0; Index < Plan.Params.Num(); ++Index)
 	{
-		if (It->HasAnyPropertyFlags(CPF_ReturnParm))
+		if (Params[Index].TypeName != NAME_GMPSkipValidate && !(ensure(FNameSuccession::IsTypeCompatible(Plan.Params[Index].TypeName, Params[Index].TypeName))))
+			return false;
+	}
+#endif
+
+	for (int32 Index = 0; Index < Plan.Params.Num(); ++Index)
+	{
+		auto& Param = Plan.Params[Index];
+		uint8* Dest = static_cast<uint8*>(FramePtr) + Param.Offset;
+		if (Param.bPod)
 		{
-			bSucc = false;
-			break;
+			// fully overwritten, no need to construct first
+			FMemory::Memcpy(Dest, Params[Index].ToAddr(), Param.Size);
 		}
-		FProperty* Prop = *It;
-
-#if GMP_WITH_DYNAMIC_TYPE_CHECK
-		if (Params[Index].TypeName != NAME_GMPSkipValidate && !(ensure(FNameSuccession::IsTypeCompatible(Reflection::GetPropertyName(Prop, true), Params[Index].TypeName))))
+		else
 		{
-			bSucc = false;
-			break;
+			Param.Prop->InitializeValue(Dest);
+			Param.Prop->CopyCompleteValue(Dest, Params[Index].ToAddr());
 		}
-#endif
-
-		Prop->CopyCompleteValue(Prop->ContainerPtrToValuePtr<void>(FramePtr), Params[Index].ToAddr());
-		++Index;
 	}
-	if (!bSucc)
-		DestroyFunctionParameters(Function, FramePtr);
-	return bSucc;
+	return true;
 }
 
 void UGMPBPLib::CallFunctionPacked(UObject* Obj, FName FuncName, TArray<FGMPTypedAddr>& Params)
@@ -1539,7 +2138,7 @@ DEFINE_FUNCTION(UGMPBPLib::execCallFunctionVariadic)
 	P_FINISH
 	return;
 #else
-	TArray<FGMPTypedAddr> MsgArr;
+	GMP::FTypedAddresses MsgArr;
 
 	while (Stack.PeekCode() != EX_EndFunctionParms)
 	{
@@ -1567,73 +2166,83 @@ DEFINE_FUNCTION(UGMPBPLib::execCallObjectFunctionByName)
 	// in declaration order. We must marshal the scattered blueprint pin values into a
 	// single contiguous Parms block (the layout ProcessEvent requires), invoke, then
 	// copy out/return values back to their pins.
+	using namespace GMP;
 	P_GET_OBJECT(UObject, Obj);
 	P_GET_PROPERTY(FNameProperty, FuncName);
 
-	// Capture each variadic pin's (property, address) in declaration order.
-	struct FPinArg { FProperty* Prop; void* Addr; };
-	TArray<FPinArg, TInlineAllocator<8>> PinArgs;
+	// Capture each variadic pin's address in declaration order.
+	TArray<void*, TInlineAllocator<8>> PinAddrs;
 	while (Stack.PeekCode() != EX_EndFunctionParms)
 	{
 		Stack.MostRecentProperty = nullptr;
 		Stack.MostRecentPropertyAddress = nullptr;
 		Stack.StepCompiledIn<FProperty>(nullptr);
-		PinArgs.Add({ Stack.MostRecentProperty, Stack.MostRecentPropertyAddress });
+		PinAddrs.Add(Stack.MostRecentProperty ? Stack.MostRecentPropertyAddress : nullptr);
 	}
 	P_FINISH
 
 	P_NATIVE_BEGIN
+	CallFunctionByName(Obj, FuncName, PinAddrs);
+	P_NATIVE_END
+}
+
+bool UGMPBPLib::CallFunctionByName(UObject* Obj, FName FuncName, TArrayView<void* const> PinAddrs)
+{
+	using namespace GMP;
 	UFunction* Fn = Obj ? Obj->FindFunction(FuncName) : nullptr;
-	if (!Obj || !Fn)
+	if (!Fn)
 	{
 		FFrame::KismetExecutionMessage(*FString::Printf(TEXT("GMPCallByName: function '%s' not found on '%s'"), *FuncName.ToString(), Obj ? *Obj->GetClass()->GetName() : TEXT("null")),
 									   ELogVerbosity::Warning,
 									   TEXT("GMPCallByName"));
-		return;
+		return false;
 	}
+	// pinned for the whole call, the cached plan may be dropped inside ProcessEvent
+	FrameCopy::FPlan Scratch;
+	TSharedPtr<const FrameCopy::FPlan> Pin;
+	const FrameCopy::FPlan& Plan = FrameCopy::FindPlan(Fn, Scratch, &Pin);
 
 	// Allocate the contiguous parameter block ProcessEvent expects.
-	void* Parms = FMemory_Alloca_Aligned(Fn->ParmsSize, Fn->GetMinAlignment());
+	uint8* Parms = static_cast<uint8*>(FMemory_Alloca_Aligned(Fn->ParmsSize, Fn->GetMinAlignment()));
 	FMemory::Memzero(Parms, Fn->ParmsSize);
 
-	// Initialize every parameter slot (required for structs/arrays/strings, etc.).
-	for (TFieldIterator<FProperty> It(Fn); It && (It->PropertyFlags & CPF_Parm); ++It)
-		It->InitializeValue_InContainer(Parms);
+	// Initialize the parameter slots which are not zero constructed (structs with constructors, etc.).
+	for (FProperty* Prop : Plan.CtorParams)
+		Prop->InitializeValue_InContainer(Parms);
 
-	// Marshal inputs in, remember outputs/return to copy back after the call.
-	struct FOutBack { FProperty* Prop; void* PinAddr; };
-	TArray<FOutBack, TInlineAllocator<4>> OutBacks;
-	int32 PinIdx = 0;
-	for (TFieldIterator<FProperty> It(Fn); It && (It->PropertyFlags & CPF_Parm); ++It)
+	// Marshal inputs in, outputs/return are copied back after the call.
+	const int32 NumPinned = FMath::Min(PinAddrs.Num(), Plan.Params.Num());
+	for (int32 PinIdx = 0; PinIdx < NumPinned; ++PinIdx)
 	{
-		FProperty* Param = *It;
-		const bool bReturn = Param->HasAnyPropertyFlags(CPF_ReturnParm);
-		// Same direction rule as UK2Node_CallFunction::CreatePinsForFunctionCall.
-		const bool bIsInput = !bReturn && (!Param->HasAnyPropertyFlags(CPF_OutParm) || Param->HasAnyPropertyFlags(CPF_ReferenceParm));
-		const bool bIsOutput = bReturn || (Param->HasAnyPropertyFlags(CPF_OutParm) && !Param->HasAnyPropertyFlags(CPF_ConstParm));
-
-		void* ParamAddr = Param->ContainerPtrToValuePtr<void>(Parms);
-
-		if (PinArgs.IsValidIndex(PinIdx) && PinArgs[PinIdx].Addr && PinArgs[PinIdx].Prop)
+		auto& Param = Plan.Params[PinIdx];
+		if (Param.bInput && PinAddrs[PinIdx])
 		{
-			if (bIsInput)
-				Param->CopyCompleteValueFromScriptVM(ParamAddr, PinArgs[PinIdx].Addr);
-			if (bIsOutput)
-				OutBacks.Add({ Param, PinArgs[PinIdx].Addr });
+			if (Param.bScriptPod)
+				FMemory::Memcpy(Parms + Param.Offset, PinAddrs[PinIdx], Param.Size);
+			else
+				Param.Prop->CopyCompleteValueFromScriptVM(Parms + Param.Offset, PinAddrs[PinIdx]);
 		}
-		++PinIdx;
 	}
 
 	Obj->ProcessEvent(Fn, Parms);
 
 	// Copy outputs / return value back to their blueprint pins.
-	for (const FOutBack& Out : OutBacks)
-		Out.Prop->CopyCompleteValueToScriptVM(Out.PinAddr, Out.Prop->ContainerPtrToValuePtr<void>(Parms));
+	for (int32 PinIdx = 0; PinIdx < NumPinned; ++PinIdx)
+	{
+		auto& Param = Plan.Params[PinIdx];
+		if (Param.bOutput && PinAddrs[PinIdx])
+		{
+			if (Param.bScriptPod)
+				FMemory::Memcpy(PinAddrs[PinIdx], Parms + Param.Offset, Param.Size);
+			else
+				Param.Prop->CopyCompleteValueToScriptVM(PinAddrs[PinIdx], Parms + Param.Offset);
+		}
+	}
 
 	// Destroy parameter values to avoid leaks / double-free.
-	for (TFieldIterator<FProperty> It(Fn); It && (It->PropertyFlags & CPF_Parm); ++It)
-		It->DestroyValue_InContainer(Parms);
-	P_NATIVE_END
+	for (FProperty* Prop : Plan.DtorParams)
+		Prop->DestroyValue_InContainer(Parms);
+	return true;
 }
 
 DEFINE_FUNCTION(UGMPBPLib::execMessageFromVariadic)
@@ -1839,6 +2448,17 @@ bool UGMPBPLib::CallMessageFunction(UObject* Obj, UFunction* Function, TArrayVie
 #endif
 
 	void* Parms = nullptr;
+	uint8* Frame = nullptr;
+	if (FastCall::IsDirectFrameEligible(Function))
+	{
+		// the parameter region of the frame is the parameter block, outputs land in it too
+		Frame = (uint8*)FMemory_Alloca_Aligned(Function->PropertiesSize, Function->GetMinAlignment());
+		FMemory::Memzero(Frame, Function->PropertiesSize);
+		if (!ensureAlways(MessageToFrame(Function, Frame, GMPArgs)))
+			return false;
+		Parms = Frame;
+	}
+	else
 	{
 		Parms = FMemory_Alloca_Aligned(Function->ParmsSize, Function->GetMinAlignment());
 		FMemory::Memzero(Parms, Function->ParmsSize);
@@ -1847,14 +2467,13 @@ bool UGMPBPLib::CallMessageFunction(UObject* Obj, UFunction* Function, TArrayVie
 	}
 	GMP_CHECK_SLOW((Function->ParmsSize == 0) || (Parms != nullptr));
 
-	uint8* Frame = nullptr;
-	if (Function->HasAnyFunctionFlags(FUNC_UbergraphFunction))
+	if (!Frame && Function->HasAnyFunctionFlags(FUNC_UbergraphFunction))
 	{
 		Frame = Function->GetOuterUClassUnchecked()->GetPersistentUberGraphFrame(Obj, Function);
 	}
 
-	const bool bUsePersistentFrame = (NULL != Frame);
-	if (!bUsePersistentFrame)
+	const bool bUsePersistentFrame = Frame && Frame != Parms;
+	if (!Frame)
 	{
 		Frame = (uint8*)FMemory_Alloca_Aligned(Function->PropertiesSize, Function->GetMinAlignment());
 		// zero the local property memory
@@ -1862,7 +2481,8 @@ bool UGMPBPLib::CallMessageFunction(UObject* Obj, UFunction* Function, TArrayVie
 	}
 
 	// initialize the parameter properties
-	FMemory::Memcpy(Frame, Parms, Function->ParmsSize);
+	if (Frame != Parms)
+		FMemory::Memcpy(Frame, Parms, Function->ParmsSize);
 
 	// Create a new local execution stack.
 	FFrame NewStack(Obj, Function, Frame, nullptr, Reflection::GetFunctionChildProperties(Function));
@@ -2414,8 +3034,183 @@ void AppendPropPairToString(TPair<FProperty*, uint8*>& Pair, FString& Out)
 		CurProp->ExportText_Direct(Out, CurAddr, nullptr, nullptr, PPF_None);
 	}
 }
+
+// A lexed format string, independent of the buffer it came from: literal text (escapes already resolved) is merged into
+// one string and every placeholder becomes a segment that first flushes the literal run before it.
+struct FFormatTemplate
+{
+	struct FSegment
+	{
+		int32 LiteralStart = 0;
+		int32 LiteralLen = 0;
+		// placeholder, TokenLen is 0 for the trailing literal run
+		int32 TokenStart = 0;
+		int32 TokenLen = 0;
+		int32 ArgIndex = INDEX_NONE;
+		int32 NameStart = 0;
+		int32 NameLen = 0;
+	};
+	FString Source;
+	FString Literals;
+	TArray<FSegment> Segments;
+	// grows to the longest output seen so far, output is reserved once
+	int32 EstimatedLen = 0;
+	bool bNamed = false;
+	bool bValid = false;
+
+	void Compile(const FString& FmtStr, bool bInNamed)
+	{
+		Source = FmtStr;
+		bNamed = bInNamed;
+		Literals.Reset();
+		Segments.Reset();
+
+		const TCHAR* Base = *Source;
+		TValueOrError<TArray<FExpressionToken>, FExpressionError> Result = bNamed ? ExtractNames(Base) : ExtractOrders(Base);
+		bValid = Result.IsValid();
+		if (!bValid)
+			return;
+
+		int32 LiteralStart = 0;
+		for (const FExpressionToken& Token : Result.GetValue())
+		{
+			const FStringToken* EntireToken = nullptr;
+			if (const FStringLiteral* Literal = Token.Node.Cast<FStringLiteral>())
+			{
+				Literals.AppendChars(Literal->String.GetTokenStartPos(), Literal->Len);
+				continue;
+			}
+			else if (const FEscapedCharacter* Escaped = Token.Node.Cast<FEscapedCharacter>())
+			{
+				Literals.AppendChar(Escaped->Character);
+				continue;
+			}
+
+			FSegment Segment;
+			if (const FIndexSpecifier* IndexToken = Token.Node.Cast<FIndexSpecifier>())
+			{
+				Segment.ArgIndex = IndexToken->Index;
+				EntireToken = &IndexToken->EntireToken;
+			}
+			else if (const FFormatSpecifier* FormatToken = Token.Node.Cast<FFormatSpecifier>())
+			{
+				Segment.NameStart = UE_PTRDIFF_TO_INT32(FormatToken->Identifier.GetTokenStartPos() - Base);
+				Segment.NameLen = FormatToken->Len;
+				EntireToken = &FormatToken->EntireToken;
+			}
+			else
+			{
+				continue;
+			}
+			Segment.LiteralStart = LiteralStart;
+			Segment.LiteralLen = Literals.Len() - LiteralStart;
+			Segment.TokenStart = UE_PTRDIFF_TO_INT32(EntireToken->GetTokenStartPos() - Base);
+			Segment.TokenLen = UE_PTRDIFF_TO_INT32(EntireToken->GetTokenEndPos() - EntireToken->GetTokenStartPos());
+			Segments.Add(Segment);
+			LiteralStart = Literals.Len();
+		}
+		if (LiteralStart < Literals.Len())
+		{
+			FSegment& Tail = Segments.AddDefaulted_GetRef();
+			Tail.LiteralStart = LiteralStart;
+			Tail.LiteralLen = Literals.Len() - LiteralStart;
+		}
+		EstimatedLen = Literals.Len() + Segments.Num() * 8;
+	}
+
+	// index of the Names entry a named placeholder resolves to, the first case-insensitive match with an argument wins
+	int32 FindName(const FSegment& Segment, const TArray<FString>& Names, int32 NumArgs) const
+	{
+		for (int32 i = 0; i < FMath::Min(Names.Num(), NumArgs); ++i)
+		{
+			if (Names[i].Len() == Segment.NameLen && FCString::Strnicmp(*Source + Segment.NameStart, *Names[i], Segment.NameLen) == 0)
+				return i;
+		}
+		return INDEX_NONE;
+	}
+
+	// FindArg(const FSegment&) returns the argument for a placeholder, unresolved placeholders are kept as written
+	template<typename F>
+	void Format(FString& Out, const F& FindArg)
+	{
+		Out.Reserve(EstimatedLen);
+		for (const FSegment& Segment : Segments)
+		{
+			Out.AppendChars(*Literals + Segment.LiteralStart, Segment.LiteralLen);
+			if (!Segment.TokenLen)
+				continue;
+			if (TPair<FProperty*, uint8*>* Arg = FindArg(Segment))
+				AppendPropPairToString(*Arg, Out);
+			else
+				Out.AppendChars(*Source + Segment.TokenStart, Segment.TokenLen);
+		}
+		EstimatedLen = FMath::Max(EstimatedLen, Out.Len());
+	}
+};
+
+// Format strings are nearly always literals, lex each one once. Game thread only, other threads compile into Scratch.
+static FFormatTemplate& FindTemplate(const FString& FmtStr, bool bNamed, FFormatTemplate& Scratch)
+{
+	if (!IsInGameThread())
+	{
+		Scratch.Compile(FmtStr, bNamed);
+		return Scratch;
+	}
+
+	static constexpr int32 MaxCachedTemplates = 1024;
+	static TMap<uint64, FFormatTemplate> Templates;
+	const uint64 Key = CityHash128to64({CityHash64(reinterpret_cast<const char*>(*FmtStr), FmtStr.Len() * sizeof(TCHAR)), uint64(bNamed)});
+	if (FFormatTemplate* Find = Templates.Find(Key))
+	{
+		if (Find->bNamed == bNamed && Find->Source.Equals(FmtStr, ESearchCase::CaseSensitive))
+			return *Find;
+		// hash collision, the newer format takes the slot
+		Find->Compile(FmtStr, bNamed);
+		return *Find;
+	}
+
+	// formats built at runtime would grow the cache without bound
+	if (Templates.Num() >= MaxCachedTemplates)
+		Templates.Reset();
+	FFormatTemplate& Template = Templates.Add(Key);
+	Template.Compile(FmtStr, bNamed);
+	return Template;
+}
 }  // namespace FormatPlaceholdersExtracter
 
+bool UGMPBPLib::BakeFormatByName(const FString& InFmtStr, const TArray<FString>& InNames, FString& OutOrderedFmt)
+{
+	using namespace FormatPlaceholdersExtracter;
+	FFormatTemplate Template;
+	Template.Compile(InFmtStr, true);
+	if (!Template.bValid)
+		return false;
+
+	OutOrderedFmt.Reset(Template.Literals.Len() + Template.Segments.Num() * 4);
+	for (const FFormatTemplate::FSegment& Segment : Template.Segments)
+	{
+		// the strict ordered lexer has no escapes, '{' and '`' can not be written back as literals
+		const TCHAR* Literal = *Template.Literals + Segment.LiteralStart;
+		for (int32 i = 0; i < Segment.LiteralLen; ++i)
+		{
+			if (Literal[i] == TEXT('{') || Literal[i] == EscapeChar)
+				return false;
+		}
+		OutOrderedFmt.AppendChars(Literal, Segment.LiteralLen);
+		if (!Segment.TokenLen)
+			continue;
+
+		// unresolved placeholders are printed as written, which an ordered format can not express either
+		const int32 Index = Template.FindName(Segment, InNames, InNames.Num());
+		if (Index == INDEX_NONE)
+			return false;
+		OutOrderedFmt.AppendChar(TEXT('{'));
+		OutOrderedFmt.AppendInt(Index);
+		OutOrderedFmt.AppendChar(TEXT('}'));
+	}
+	return true;
+}
+
 DEFINE_FUNCTION(UGMPBPLib::execFormatStringByOrder)
 {
 	P_GET_PROPERTY_REF(FStrProperty, FmtStr);
@@ -2426,8 +3221,7 @@ DEFINE_FUNCTION(UGMPBPLib::execFormatStringByOrder)
 	return;
 #else
 	P_NATIVE_BEGIN
-	TArray<TPair<FProperty*, uint8*>> Props;
-	const auto InExpression = *FmtStr;
+	TArray<TPair<FProperty*, uint8*>, TInlineAllocator<8>> Props;
 	while (Stack.PeekCode() != EX_EndFunctionParms)
 	{
 		Stack.MostRecentPropertyAddress = nullptr;
@@ -2439,52 +3233,22 @@ DEFINE_FUNCTION(UGMPBPLib::execFormatStringByOrder)
 		Props.Add(TPair<FProperty*, uint8*>{Stack.MostRecentProperty, Stack.MostRecentPropertyAddress});
 	}
 	P_FINISH
-	TValueOrError<TArray<FExpressionToken>, FExpressionError> Result = FormatPlaceholdersExtracter::ExtractOrders(InExpression);
-	if (!Result.IsValid())
+	using namespace FormatPlaceholdersExtracter;
+	FFormatTemplate Scratch;
+	FFormatTemplate& Template = FindTemplate(FmtStr, false, Scratch);
+	if (!Template.bValid)
 	{
 		FFrame::KismetExecutionMessage(TEXT("FmtStr Invalid"), ELogVerbosity::Error, TEXT("FmtStr Invalid"));
 		*(FString*)RESULT_PARAM = FmtStr;
 	}
 	else
 	{
-		using namespace FormatPlaceholdersExtracter;
-		TArray<FExpressionToken>& Tokens = Result.GetValue();
-		if (Tokens.Num() == 0)
-		{
-			*(FString*)RESULT_PARAM = FmtStr;
-		}
-		else
-		{
-			FString Formatted;
-			Formatted.Reserve(UE_PTRDIFF_TO_INT32(Tokens.Last().Context.GetTokenEndPos() - InExpression));
-			auto Index = 0;
-			for (const FExpressionToken& Token : Tokens)
-			{
-				auto CurIndex = Index++;
-				if (const FStringLiteral* Literal = Token.Node.Cast<FStringLiteral>())
-				{
-					Formatted.AppendChars(Literal->String.GetTokenStartPos(), Literal->Len);
-				}
-				else if (const FEscapedCharacter* Escaped = Token.Node.Cast<FEscapedCharacter>())
-				{
-					Formatted.AppendChar(Escaped->Character);
-				}
-				else if (const FIndexSpecifier* IndexToken = Token.Node.Cast<FIndexSpecifier>())
-				{
-					if (Props.IsValidIndex(IndexToken->Index))
-					{
-						AppendPropPairToString(Props[IndexToken->Index], Formatted);
-					}
-					else
-					{
-						// No replacement found, so just add the original token string
-						const int32 Length = UE_PTRDIFF_TO_INT32(IndexToken->EntireToken.GetTokenEndPos() - IndexToken->EntireToken.GetTokenStartPos());
-						Formatted.AppendChars(IndexToken->EntireToken.GetTokenStartPos(), Length);
-					}
-				}
-			}
-			*(FString*)RESULT_PARAM = MoveTemp(Formatted);
-		}
+		FString Formatted;
+		Template.Format(Formatted, [&](const FFormatTemplate::FSegment& Segment) {
+			// No replacement found, so just add the original token string
+			return Props.IsValidIndex(Segment.ArgIndex) ? &Props[Segment.ArgIndex] : nullptr;
+		});
+		*(FString*)RESULT_PARAM = MoveTemp(Formatted);
 	}
 	P_NATIVE_END
 #endif
@@ -2501,8 +3265,7 @@ DEFINE_FUNCTION(UGMPBPLib::execFormatStringByName)
 	return;
 #else
 	P_NATIVE_BEGIN
-	TArray<TPair<FProperty*, uint8*>> Props;
-	const auto InExpression = *FmtStr;
+	TArray<TPair<FProperty*, uint8*>, TInlineAllocator<8>> Props;
 	while (Stack.PeekCode() != EX_EndFunctionParms)
 	{
 		Stack.MostRecentPropertyAddress = nullptr;
@@ -2514,62 +3277,22 @@ DEFINE_FUNCTION(UGMPBPLib::execFormatStringByName)
 		Props.Add(TPair<FProperty*, uint8*>{Stack.MostRecentProperty, Stack.MostRecentPropertyAddress});
 	}
 	P_FINISH
-	TValueOrError<TArray<FExpressionToken>, FExpressionError> Result = FormatPlaceholdersExtracter::ExtractNames(InExpression);
-	if (!Result.IsValid())
+	using namespace FormatPlaceholdersExtracter;
+	FFormatTemplate Scratch;
+	FFormatTemplate& Template = FindTemplate(FmtStr, true, Scratch);
+	if (!Template.bValid)
 	{
 		FFrame::KismetExecutionMessage(TEXT("FmtStr Invalid"), ELogVerbosity::Error, TEXT("FmtStr Invalid"));
 		*(FString*)RESULT_PARAM = FmtStr;
 	}
 	else
 	{
-		using namespace FormatPlaceholdersExtracter;
-		TArray<FExpressionToken>& Tokens = Result.GetValue();
-		if (Tokens.Num() == 0)
-		{
-			*(FString*)RESULT_PARAM = FmtStr;
-		}
-		else
-		{
-			// This code deliberately tries to reallocate as little as possible
-			FString Formatted;
-			Formatted.Reserve(UE_PTRDIFF_TO_INT32(Tokens.Last().Context.GetTokenEndPos() - InExpression));
-			auto Index = 0;
-			for (const FExpressionToken& Token : Tokens)
-			{
-				if (const FStringLiteral* Literal = Token.Node.Cast<FStringLiteral>())
-				{
-					Formatted.AppendChars(Literal->String.GetTokenStartPos(), Literal->Len);
-				}
-				else if (const FEscapedCharacter* Escaped = Token.Node.Cast<FEscapedCharacter>())
-				{
-					Formatted.AppendChar(Escaped->Character);
-				}
-				else if (const FFormatSpecifier* FormatToken = Token.Node.Cast<FFormatSpecifier>())
-				{
-					TPair<FProperty*, uint8*>* Prop = nullptr;
-					for (auto i = 0; i < Names.Num(); ++i)
-					{
-						auto& Name = Names[i];
-						if (Name.Len() == FormatToken->Len && FCString::Strnicmp(FormatToken->Identifier.GetTokenStartPos(), *Name, FormatToken->Len) == 0 && Props.IsValidIndex(i))
-						{
-							Prop = &Props[i];
-							break;
-						}
-					}
-
-					if (Prop)
-					{
-						AppendPropPairToString(*Prop, Formatted);
-					}
-					else
-					{
-						const int32 Length = UE_PTRDIFF_TO_INT32(FormatToken->EntireToken.GetTokenEndPos() - FormatToken->EntireToken.GetTokenStartPos());
-						Formatted.AppendChars(FormatToken->EntireToken.GetTokenStartPos(), Length);
-					}
-				}
-			}
-			*(FString*)RESULT_PARAM = MoveTemp(Formatted);
-		}
+		FString Formatted;
+		Template.Format(Formatted, [&](const FFormatTemplate::FSegment& Segment) {
+			const int32 Index = Template.FindName(Segment, Names, Props.Num());
+			return Props.IsValidIndex(Index) ? &Props[Index] : nullptr;
+		});
+		*(FString*)RESULT_PARAM = MoveTemp(Formatted);
 	}
 	P_NATIVE_END
 #endif
@@ -0,0 +1,916 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+//
+// GMP benchmark suites, driven by the GMPBenchmark commandlet (see GMPUnitTestCommandlet.cpp):
+//   <Editor>-Cmd <Project> -run=GMPBenchmark [-Suite=All|Dispatch|Serializer] [-Filter=send.native]
+//       [-Listeners=1,8,64] [-Sources=1,16] [-Arity=0,1,3] [-Elements=16,256]
+//       [-Samples=30] [-Iters=20000] [-Warmup=3] [-Json=<path>] [-Baseline=<path> -MaxRegression=10 -MaxAllocRegression=0.5]
+// Every scenario runs Warmup discarded samples, then Samples timed batches of Iters operations. The report holds
+// min/mean/p50/p90/p99 ns per operation and the game-thread allocation count per operation, and is written as JSON
+// (default Saved/GMPBench/<Suite>-<timestamp>.json) so build machines can diff runs. With -Baseline the exit code
+// also counts the results that regressed against a previous report. Under -Suite=All both -Json and -Baseline
+// refer to <path>-<Suite>.json, so a baseline run and a later compare run can share the same arguments.
+// The quick correctness-side micro benchmark (-run=GMPUnitTest -Bench) stays in GMPTests.cpp.
+#include "GMPUnitTestCommandlet.h"
+
+#include "GMPArchive.h"
+#include "GMPHub.h"
+#include "GMPJsonSerializer.h"
+#include "GMPMacros.h"
+#include "GMPProtoSerializer.h"
+#include "GMPUtils.h"
+#include "GMPValueOneOf.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/Package.h"
+
+#if GMP_WITH_DIRECT_SIGNAL
+#include "GMPHubOpt.h"
+#define MSGKEY_SLOT(str) GMP::GetKeySlot<C_STRING_TYPE(str)>()
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogGMPBench, Log, All);
+namespace GMPUnitTest
+{
+namespace Bench
+{
+using namespace GMP;
+
+static volatile int64 GBenchSink = 0;
+
+// ---- allocation counting ---------------------------------------------------
+// Forwards everything to the real allocator and counts the calls made by the benchmarking thread only. It is swapped
+// into GMalloc around the timed samples and never destroyed, since other threads may still hold the pointer.
+class FCountingMalloc final : public FMalloc
+{
+public:
+	explicit FCountingMalloc(FMalloc* InInner)
+		: Inner(InInner)
+	{
+	}
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		Track(Count);
+		return Inner->Malloc(Count, Alignment);
+	}
+	virtual void* Realloc(void* Ptr, SIZE_T NewSize, uint32 Alignment) override
+	{
+		Track(NewSize);
+		return Inner->Realloc(Ptr, NewSize, Alignment);
+	}
+#if UE_5_00_OR_LATER
+	virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+	{
+		Track(Count);
+		return Inner->TryMalloc(Count, Alignment);
+	}
+	virtual void* TryRealloc(void* Ptr, SIZE_T NewSize, uint32 Alignment) override
+	{
+		Track(NewSize);
+		return Inner->TryRealloc(Ptr, NewSize, Alignment);
+	}
+#endif
+	virtual void Free(void* Ptr) override { Inner->Free(Ptr); }
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+	virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+	virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+	virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+	virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+	virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+	FMalloc* const Inner;
+	uint32 TrackedThreadId = 0;
+	int64 Count = 0;
+	int64 Bytes = 0;
+
+private:
+	FORCEINLINE void Track(SIZE_T Size)
+	{
+		if (FPlatformTLS::GetCurrentThreadId() == TrackedThreadId)
+		{
+			++Count;
+			Bytes += Size;
+		}
+	}
+};
+
+struct FAllocScope
+{
+	FAllocScope()
+	{
+		static FCountingMalloc* Proxy = new (FMemory::Malloc(sizeof(FCountingMalloc))) FCountingMalloc(GMalloc);
+		if (GMalloc == Proxy->Inner)
+		{
+			Counter = Proxy;
+			Counter->TrackedThreadId = FPlatformTLS::GetCurrentThreadId();
+			Counter->Count = 0;
+			Counter->Bytes = 0;
+			FPlatformMisc::MemoryBarrier();
+			GMalloc = Counter;
+		}
+	}
+	~FAllocScope()
+	{
+		if (Counter)
+		{
+			GMalloc = Counter->Inner;
+			Counter->TrackedThreadId = 0;
+		}
+	}
+	bool IsValid() const { return !!Counter; }
+	int64 GetCount() const { return Counter ? Counter->Count : 0; }
+	int64 GetBytes() const { return Counter ? Counter->Bytes : 0; }
+
+	FCountingMalloc* Counter = nullptr;
+};
+
+// ---- measurement -----------------------------------------------------------
+struct FBenchConfig
+{
+	TArray<int32> Listeners{1, 8, 64};
+	TArray<int32> Sources{1, 16};
+	TArray<int32> Arities{0, 1, 3};
+	int32 Samples = 30;
+	int32 Warmup = 3;
+	int64 Iters = 20000;
+	FString Filter;
+
+	bool Accept(const TCHAR* Name) const { return Filter.IsEmpty() || FCString::Stristr(Name, *Filter) != nullptr; }
+};
+
+struct FBenchResult
+{
+	FString Name;
+	TArray<TPair<FString, int64>> Dims;
+	int64 OpsPerSample = 0;
+	int32 Samples = 0;
+	double MinNs = 0.0;
+	double MeanNs = 0.0;
+	double P50Ns = 0.0;
+	double P90Ns = 0.0;
+	double P99Ns = 0.0;
+	double AllocsPerOp = -1.0;
+	double AllocBytesPerOp = -1.0;
+	// suite specific figures such as wire bytes or MB/s
+	TArray<TPair<FString, double>> Metrics;
+
+	FString GetId() const
+	{
+		FString Id = Name;
+		for (auto& Dim : Dims)
+			Id += FString::Printf(TEXT("/%s=%lld"), *Dim.Key, Dim.Value);
+		return Id;
+	}
+};
+
+static double Percentile(const TArray<double>& Sorted, double P)
+{
+	if (Sorted.Num() == 0)
+		return 0.0;
+	const int32 Idx = FMath::Clamp(FMath::CeilToInt(P * Sorted.Num()) - 1, 0, Sorted.Num() - 1);
+	return Sorted[Idx];
+}
+
+// Body(Ops) must perform Ops operations, timing excludes anything outside it
+template<typename F>
+static FBenchResult Measure(const FBenchConfig& Cfg, const TCHAR* Name, TArray<TPair<FString, int64>> Dims, int64 Ops, const F& Body)
+{
+	for (int32 i = 0; i < Cfg.Warmup; ++i)
+		Body(Ops);
+
+	TArray<double> NsPerOp;
+	NsPerOp.Reserve(Cfg.Samples);
+	int64 Allocs = 0;
+	int64 AllocBytes = 0;
+	bool bCounted = false;
+	for (int32 i = 0; i < Cfg.Samples; ++i)
+	{
+		FAllocScope AllocScope;
+		const double T0 = FPlatformTime::Seconds();
+		Body(Ops);
+		const double Elapsed = FPlatformTime::Seconds() - T0;
+		Allocs += AllocScope.GetCount();
+		AllocBytes += AllocScope.GetBytes();
+		bCounted |= AllocScope.IsValid();
+		NsPerOp.Add(Elapsed / Ops * 1e9);
+	}
+
+	FBenchResult Result;
+	Result.Name = Name;
+	Result.Dims = MoveTemp(Dims);
+	Result.OpsPerSample = Ops;
+	Result.Samples = NsPerOp.Num();
+	if (NsPerOp.Num() > 0)
+	{
+		double Sum = 0.0;
+		for (double V : NsPerOp)
+			Sum += V;
+		Result.MeanNs = Sum / NsPerOp.Num();
+		NsPerOp.Sort();
+		Result.MinNs = NsPerOp[0];
+		Result.P50Ns = Percentile(NsPerOp, 0.50);
+		Result.P90Ns = Percentile(NsPerOp, 0.90);
+		Result.P99Ns = Percentile(NsPerOp, 0.99);
+	}
+	if (bCounted && NsPerOp.Num() > 0)
+	{
+		const double TotalOps = double(Ops) * NsPerOp.Num();
+		Result.AllocsPerOp = Allocs / TotalOps;
+		Result.AllocBytesPerOp = AllocBytes / TotalOps;
+	}
+
+	return Result;
+}
+
+static void AddResult(TArray<FBenchResult>& Results, FBenchResult&& Result)
+{
+	FString MetricStr;
+	for (auto& Metric : Result.Metrics)
+		MetricStr += FString::Printf(TEXT(" %s=%.2f"), *Metric.Key, Metric.Value);
+	UE_LOG(LogGMPBench, Display, TEXT("[Bench] %s | p50=%.1fns p90=%.1fns p99=%.1fns min=%.1fns mean=%.1fns allocs/op=%.3f%s"),
+		*Result.GetId(), Result.P50Ns, Result.P90Ns, Result.P99Ns, Result.MinNs, Result.MeanNs, Result.AllocsPerOp, *MetricStr);
+	Results.Add(MoveTemp(Result));
+}
+
+static void ParseIntList(const FString& Params, const TCHAR* Key, TArray<int32>& Out)
+{
+	FString Str;
+	if (!FParse::Value(*Params, Key, Str, false))
+		return;
+	TArray<FString> Parts;
+	Str.ParseIntoArray(Parts, TEXT(","));
+	Out.Reset();
+	for (auto& Part : Parts)
+		Out.Add(FMath::Max(0, FCString::Atoi(*Part)));
+}
+
+static FBenchConfig ParseConfig(const FString& Params)
+{
+	FBenchConfig Cfg;
+	ParseIntList(Params, TEXT("Listeners="), Cfg.Listeners);
+	ParseIntList(Params, TEXT("Sources="), Cfg.Sources);
+	ParseIntList(Params, TEXT("Arity="), Cfg.Arities);
+	FParse::Value(*Params, TEXT("Samples="), Cfg.Samples);
+	FParse::Value(*Params, TEXT("Warmup="), Cfg.Warmup);
+	FParse::Value(*Params, TEXT("Iters="), Cfg.Iters);
+	FParse::Value(*Params, TEXT("Filter="), Cfg.Filter);
+	Cfg.Samples = FMath::Max(Cfg.Samples, 1);
+	Cfg.Warmup = FMath::Max(Cfg.Warmup, 0);
+	Cfg.Iters = FMath::Max<int64>(Cfg.Iters, 1);
+	return Cfg;
+}
+
+// -Json= and -Baseline= name one report per suite, under -Suite=All each suite appends its name to the given path
+static bool ParseSuitePath(const FString& Params, const TCHAR* Key, const TCHAR* Suite, FString& OutPath)
+{
+	if (!FParse::Value(*Params, Key, OutPath))
+		return false;
+	FString SuiteFilter;
+	if (!FParse::Value(*Params, TEXT("Suite="), SuiteFilter) || SuiteFilter == TEXT("All"))
+		OutPath = FPaths::GetBaseFilename(OutPath, false) + TEXT("-") + Suite + TEXT(".json");
+	return true;
+}
+
+static bool WriteReport(const FString& Params, const TCHAR* Suite, const FBenchConfig& Cfg, const TArray<FBenchResult>& Results)
+{
+	GMP::Json::FJsonObjBuilder Builder;
+	Builder.AddKeyValue(TEXT("suite"), FString(Suite));
+	Builder.AddKeyValue(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+	Builder.Key(TEXT("build"));
+	Builder.ScopeObject([&] {
+		Builder.AddKeyValue(TEXT("config"), FString(LexToString(FApp::GetBuildConfiguration())));
+		Builder.AddKeyValue(TEXT("platform"), FString(FPlatformMisc::GetUBTPlatform()));
+		Builder.AddKeyValue(TEXT("cpu"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+		Builder.AddKeyValue(TEXT("engine"), FString::Printf(TEXT("%d.%d"), ENGINE_MAJOR_VERSION, ENGINE_MINOR_VERSION));
+		Builder.AddKeyValue(TEXT("GMP_SIGNAL_BACKEND_FLEX"), int32(GMP_SIGNAL_BACKEND_FLEX));
+		Builder.AddKeyValue(TEXT("GMP_WITH_INLINE_FIRE"), int32(GMP_WITH_INLINE_FIRE));
+		Builder.AddKeyValue(TEXT("GMP_WITH_DIRECT_SIGNAL"), int32(GMP_WITH_DIRECT_SIGNAL));
+		Builder.AddKeyValue(TEXT("GMP_WITH_DYNAMIC_CALL_CHECK"), int32(GMP_WITH_DYNAMIC_CALL_CHECK));
+	});
+	Builder.Key(TEXT("params"));
+	Builder.ScopeObject([&] {
+		Builder.AddKeyValue(TEXT("samples"), Cfg.Samples);
+		Builder.AddKeyValue(TEXT("warmup"), Cfg.Warmup);
+		Builder.AddKeyValue(TEXT("iters"), Cfg.Iters);
+		Builder.AddKeyValue(TEXT("filter"), Cfg.Filter);
+	});
+	Builder.Key(TEXT("results"));
+	Builder.ScopeArray([&] {
+		for (auto& Result : Results)
+		{
+			Builder.ScopeObject([&] {
+				Builder.AddKeyValue(TEXT("id"), Result.GetId());
+				Builder.AddKeyValue(TEXT("name"), Result.Name);
+				for (auto& Dim : Result.Dims)
+					Builder.AddKeyValue(Dim.Key, Dim.Value);
+				Builder.AddKeyValue(TEXT("ops_per_sample"), Result.OpsPerSample);
+				Builder.AddKeyValue(TEXT("samples"), Result.Samples);
+				Builder.AddKeyValue(TEXT("min_ns"), Result.MinNs);
+				Builder.AddKeyValue(TEXT("mean_ns"), Result.MeanNs);
+				Builder.AddKeyValue(TEXT("p50_ns"), Result.P50Ns);
+				Builder.AddKeyValue(TEXT("p90_ns"), Result.P90Ns);
+				Builder.AddKeyValue(TEXT("p99_ns"), Result.P99Ns);
+				Builder.AddKeyValue(TEXT("allocs_per_op"), Result.AllocsPerOp);
+				Builder.AddKeyValue(TEXT("alloc_bytes_per_op"), Result.AllocBytesPerOp);
+				for (auto& Metric : Result.Metrics)
+					Builder.AddKeyValue(Metric.Key, Metric.Value);
+			});
+		}
+	});
+
+	FString JsonPath;
+	if (!ParseSuitePath(Params, TEXT("Json="), Suite, JsonPath))
+		JsonPath = FPaths::ProjectSavedDir() / TEXT("GMPBench") / FString::Printf(TEXT("%s-%s.json"), Suite, *FDateTime::Now().ToString());
+	const bool bSaved = Builder.SaveArrayToFile(*JsonPath);
+	UE_CLOG(bSaved, LogGMPBench, Display, TEXT("[Bench] report written to %s"), *JsonPath);
+	UE_CLOG(!bSaved, LogGMPBench, Error, TEXT("[Bench] failed to write report %s"), *JsonPath);
+	return bSaved;
+}
+
+// ---- dispatch fixtures -----------------------------------------------------
+template<int32 N>
+struct TArity;
+
+template<>
+struct TArity<0>
+{
+	struct FValues
+	{
+	};
+	static auto Key() { return MSGKEY("GMP.Bench.Arity0"); }
+#if GMP_WITH_DIRECT_SIGNAL
+	static auto Slot() { return MSGKEY_SLOT("GMP.Bench.Direct0"); }
+#endif
+	static auto Listener()
+	{
+		return [] { GBenchSink += 1; };
+	}
+	template<typename F>
+	static void Invoke(FValues& Values, const F& Func)
+	{
+		Func();
+	}
+	static FTypedAddresses MakeAddrs(FValues& Values) { return {}; }
+};
+
+template<>
+struct TArity<1>
+{
+	struct FValues
+	{
+		int32 I = 1;
+	};
+	static auto Key() { return MSGKEY("GMP.Bench.Arity1"); }
+#if GMP_WITH_DIRECT_SIGNAL
+	static auto Slot() { return MSGKEY_SLOT("GMP.Bench.Direct1"); }
+#endif
+	static auto Listener()
+	{
+		return [](int32 I) { GBenchSink += I; };
+	}
+	template<typename F>
+	static void Invoke(FValues& Values, const F& Func)
+	{
+		Func(Values.I);
+	}
+	static FTypedAddresses MakeAddrs(FValues& Values) { return {FGMPTypedAddr::MakeMsg(Values.I)}; }
+};
+
+template<>
+struct TArity<3>
+{
+	struct FValues
+	{
+		int32 I = 1;
+		float F = 1.f;
+		FVector V = FVector::OneVector;
+	};
+	static auto Key() { return MSGKEY("GMP.Bench.Arity3"); }
+#if GMP_WITH_DIRECT_SIGNAL
+	static auto Slot() { return MSGKEY_SLOT("GMP.Bench.Direct3"); }
+#endif
+	static auto Listener()
+	{
+		return [](int32 I, float F, const FVector& V) { GBenchSink += I + int64(F + V.X); };
+	}
+	template<typename F>
+	static void Invoke(FValues& Values, const F& Func)
+	{
+		Func(Values.I, Values.F, Values.V);
+	}
+	static FTypedAddresses MakeAddrs(FValues& Values) { return {FGMPTypedAddr::MakeMsg(Values.I), FGMPTypedAddr::MakeMsg(Values.F), FGMPTypedAddr::MakeMsg(Values.V)}; }
+};
+
+struct FDispatchFixture
+{
+	FDispatchFixture(int32 NumSources, int32 NumListeners)
+	{
+		for (int32 i = 0; i < NumSources; ++i)
+		{
+			UObject* Obj = NewObject<UGMPTestProbe>(GetTransientPackage(), UGMPTestProbe::StaticClass(), NAME_None, RF_Transient);
+			Obj->AddToRoot();
+			Sources.Add(Obj);
+		}
+		for (int32 i = 0; i < NumListeners; ++i)
+			Handles.Add(MakeUnique<FSigHandle>());
+	}
+	~FDispatchFixture()
+	{
+		Handles.Reset();  // disconnects every listener
+		for (UObject* Obj : Sources)
+			Obj->RemoveFromRoot();
+	}
+
+	TArray<UObject*> Sources;
+	TArray<TUniquePtr<FSigHandle>> Handles;
+};
+
+template<int32 N>
+static void RunDispatchArity(const FBenchConfig& Cfg, TArray<FBenchResult>& Results)
+{
+	using FArity = TArity<N>;
+	auto* Hub = FMessageUtils::GetMessageHub();
+	typename FArity::FValues Values;
+
+	for (int32 NumListeners : Cfg.Listeners)
+	{
+		for (int32 NumSources : Cfg.Sources)
+		{
+			NumSources = FMath::Max(NumSources, 1);
+			const TArray<TPair<FString, int64>> Dims{{TEXT("listeners"), NumListeners}, {TEXT("sources"), NumSources}, {TEXT("arity"), N}};
+
+			if (Cfg.Accept(TEXT("send.native")) || Cfg.Accept(TEXT("send.script")))
+			{
+				FDispatchFixture Fixture(NumSources, NumListeners);
+				for (UObject* Src : Fixture.Sources)
+				{
+					for (auto& Handle : Fixture.Handles)
+						Hub->ListenObjectMessage(FArity::Key(), Src, Handle.Get(), FArity::Listener());
+				}
+
+				if (Cfg.Accept(TEXT("send.native")))
+				{
+					AddResult(Results, Measure(Cfg, TEXT("send.native"), Dims, Cfg.Iters, [&](int64 Ops) {
+						for (int64 i = 0; i < Ops; ++i)
+						{
+							UObject* Src = Fixture.Sources[i % NumSources];
+							FArity::Invoke(Values, [&](auto&... Args) { Hub->SendObjectMessage(FArity::Key(), Src, Args...); });
+						}
+					}));
+				}
+
+				if (Cfg.Accept(TEXT("send.script")))
+				{
+					FTypedAddresses Params = FArity::MakeAddrs(Values);
+					AddResult(Results, Measure(Cfg, TEXT("send.script"), Dims, Cfg.Iters, [&](int64 Ops) {
+						for (int64 i = 0; i < Ops; ++i)
+							Hub->ScriptNotifyMessage(FArity::Key(), Params, FSigSource(Fixture.Sources[i % NumSources]));
+					}));
+				}
+			}
+
+			// per-call argument marshalling of a Blueprint listener: the full list from MakeFullParameters (all body data)
+			// plus the BP-visible parameter array, see UGMPBPLib::ListenMessageViaKey
+			if (Cfg.Accept(TEXT("send.bpargs")))
+			{
+				FDispatchFixture Fixture(NumSources, 0);
+				FDispatchFixture Listeners(NumListeners, 0);
+				for (UObject* Src : Fixture.Sources)
+				{
+					for (UObject* Listener : Listeners.Sources)
+					{
+						Hub->ScriptListenMessage(FSigSource(Src), FArity::Key(), Listener, [](FMessageBody& Msg) {
+							int32 OutCnt = 0;
+							FPooledTypedAddrArray InnerArr;
+							FTypedAddresses FullParams = Msg.MakeFullParameters(0xf, OutCnt, InnerArr.Get());
+							GBenchSink += FullParams.Num() + InnerArr->Num();
+						});
+					}
+				}
+
+				FTypedAddresses Params = FArity::MakeAddrs(Values);
+				AddResult(Results, Measure(Cfg, TEXT("send.bpargs"), Dims, Cfg.Iters, [&](int64 Ops) {
+					for (int64 i = 0; i < Ops; ++i)
+						Hub->ScriptNotifyMessage(FArity::Key(), Params, FSigSource(Fixture.Sources[i % NumSources]));
+				}));
+				for (UObject* Listener : Listeners.Sources)
+					Hub->ScriptUnbindMessage(FArity::Key(), Listener);
+			}
+
+#if GMP_WITH_DIRECT_SIGNAL
+			if (Cfg.Accept(TEXT("send.direct")))
+			{
+				FDispatchFixture Fixture(NumSources, NumListeners);
+				auto Slot = FArity::Slot();
+				for (UObject* Src : Fixture.Sources)
+				{
+					for (auto& Handle : Fixture.Handles)
+						DirectTyped::ListenObjectMessageDirect(Slot, FSigSource(Src), Handle.Get(), FArity::Listener());
+				}
+				AddResult(Results, Measure(Cfg, TEXT("send.direct"), Dims, Cfg.Iters, [&](int64 Ops) {
+					for (int64 i = 0; i < Ops; ++i)
+					{
+						FSigSource Src(Fixture.Sources[i % NumSources]);
+						FArity::Invoke(Values, [&](auto&... Args) { DirectTyped::SendObjectMessageDirect(Slot, Src, Args...); });
+					}
+				}));
+			}
+#endif
+		}
+
+		// listen + unbind of one extra listener while NumListeners are already bound on the same key/source
+		if (Cfg.Accept(TEXT("listen.unbind")))
+		{
+			FDispatchFixture Fixture(1, NumListeners + 1);
+			UObject* Src = Fixture.Sources[0];
+			for (int32 i = 0; i < NumListeners; ++i)
+				Hub->ListenObjectMessage(FArity::Key(), Src, Fixture.Handles[i].Get(), FArity::Listener());
+			FSigHandle* Extra = Fixture.Handles.Last().Get();
+			const int64 Ops = FMath::Min<int64>(Cfg.Iters, 4096);
+			AddResult(Results, Measure(Cfg, TEXT("listen.unbind"), {{TEXT("listeners"), NumListeners}, {TEXT("sources"), 1}, {TEXT("arity"), N}}, Ops, [&](int64 InOps) {
+				for (int64 i = 0; i < InOps; ++i)
+				{
+					FGMPKey Key = Hub->ListenObjectMessage(FArity::Key(), Src, Extra, FArity::Listener());
+					Hub->UnbindMessage(FArity::Key(), Key);
+				}
+			}));
+		}
+	}
+}
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FBenchMulticast, int32);
+
+static void RunDispatchSuite(const FBenchConfig& Cfg, TArray<FBenchResult>& Results)
+{
+	// native baseline: what a hand written multicast delegate costs for the same listener counts
+	if (Cfg.Accept(TEXT("send.multicast")))
+	{
+		for (int32 NumListeners : Cfg.Listeners)
+		{
+			FBenchMulticast Multicast;
+			for (int32 i = 0; i < NumListeners; ++i)
+				Multicast.AddLambda([](int32 I) { GBenchSink += I; });
+			AddResult(Results, Measure(Cfg, TEXT("send.multicast"), {{TEXT("listeners"), NumListeners}, {TEXT("sources"), 1}, {TEXT("arity"), 1}}, Cfg.Iters, [&](int64 Ops) {
+				for (int64 i = 0; i < Ops; ++i)
+					Multicast.Broadcast(1);
+			}));
+		}
+	}
+
+	for (int32 Arity : Cfg.Arities)
+	{
+		switch (Arity)
+		{
+			case 0: RunDispatchArity<0>(Cfg, Results); break;
+			case 1: RunDispatchArity<1>(Cfg, Results); break;
+			case 3: RunDispatchArity<3>(Cfg, Results); break;
+			default: UE_LOG(LogGMPBench, Warning, TEXT("[Bench] arity %d is not benchmarked (0, 1, 3)"), Arity); break;
+		}
+	}
+
+	// signature checks answered from the FNameSuccession type registry: two id lookups and a bit test per verdict
+	if (Cfg.Accept(TEXT("types.derived")))
+	{
+		const FName Derived = FNameSuccession::GetNativeClassName(UGMPTestProbe::StaticClass());
+		const FName Base = FNameSuccession::GetNativeClassName(UObject::StaticClass());
+		AddResult(Results, Measure(Cfg, TEXT("types.derived"), {}, Cfg.Iters, [&](int64 Ops) {
+			for (int64 i = 0; i < Ops; ++i)
+				GBenchSink += FNameSuccession::IsDerivedFrom(Derived, Base);
+		}));
+	}
+	if (Cfg.Accept(TEXT("types.enum")))
+	{
+		const FName Int = TClass2Name<uint8>::GetFName();
+		const FName Enum = Class2Name::TTraitsEnumBase::EnumAsBytesFName(TEXT("EMessageAuthorityType"), 1);
+		AddResult(Results, Measure(Cfg, TEXT("types.enum"), {}, Cfg.Iters, [&](int64 Ops) {
+			for (int64 i = 0; i < Ops; ++i)
+				GBenchSink += FNameSuccession::MatchEnums(Int, Enum);
+		}));
+	}
+}
+
+// ---- serializer fixtures ---------------------------------------------------
+static FString BenchString(int32 Seed) { return FString::Printf(TEXT("gmp-bench-%08x-payload"), Seed * 2654435761u); }
+
+static void FillLeaf(FGMPBenchLeaf& Leaf, int32 Seed)
+{
+	Leaf.Id = Seed;
+	Leaf.Weight = Seed * 0.25f;
+	Leaf.Label = BenchString(Seed);
+	Leaf.Pos = FVector(Seed, Seed * 2, Seed * 3);
+}
+
+static void FillWide(FGMPBenchWide& Wide, int32 Seed)
+{
+	Wide.bFlag0 = true;
+	Wide.bFlag1 = (Seed & 1) != 0;
+	int32* Ints[] = {&Wide.Int0, &Wide.Int1, &Wide.Int2, &Wide.Int3, &Wide.Int4, &Wide.Int5, &Wide.Int6, &Wide.Int7};
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Ints); ++i)
+		*Ints[i] = Seed * 131 + i;
+	int64* Bigs[] = {&Wide.Big0, &Wide.Big1, &Wide.Big2, &Wide.Big3};
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Bigs); ++i)
+		*Bigs[i] = (int64(Seed) << 33) + i;
+	float* Floats[] = {&Wide.Float0, &Wide.Float1, &Wide.Float2, &Wide.Float3};
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Floats); ++i)
+		*Floats[i] = Seed * 1.5f + i;
+	Wide.Double0 = Seed * 3.14159;
+	Wide.Double1 = -Seed * 2.71828;
+	FString* Strs[] = {&Wide.Str0, &Wide.Str1, &Wide.Str2, &Wide.Str3};
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Strs); ++i)
+		*Strs[i] = BenchString(Seed + i);
+	Wide.Name0 = FName(TEXT("GMPBenchName"), Seed);
+	Wide.Name1 = FName(TEXT("GMPBenchOther"), Seed + 1);
+	Wide.Vec0 = FVector(Seed, -Seed, Seed * 0.5);
+	Wide.Vec1 = FVector(-Seed, Seed, Seed * 2.0);
+}
+
+static void FillFixture(FGMPBenchWide& Data, int32 Elements) { FillWide(Data, Elements); }
+
+static void FillFixture(FGMPBenchNested& Data, int32 Elements)
+{
+	FillWide(Data.Header, Elements);
+	const int32 NumBranches = FMath::Max(1, Elements / 8);
+	Data.Branches.SetNum(NumBranches);
+	for (int32 b = 0; b < NumBranches; ++b)
+	{
+		FillLeaf(Data.Branches[b].Head, b);
+		Data.Branches[b].Leaves.SetNum(8);
+		for (int32 l = 0; l < 8; ++l)
+			FillLeaf(Data.Branches[b].Leaves[l], b * 8 + l);
+	}
+}
+
+static void FillFixture(FGMPBenchArrays& Data, int32 Elements)
+{
+	for (int32 i = 0; i < Elements; ++i)
+	{
+		Data.Bytes.Add(uint8(i));
+		Data.Ints.Add(i * 7919);
+		Data.Floats.Add(i * 0.5f);
+		Data.Strings.Add(BenchString(i));
+		Data.Vectors.Add(FVector(i, i + 1, i + 2));
+		FillLeaf(Data.Leaves.AddDefaulted_GetRef(), i);
+	}
+}
+
+static void FillFixture(FGMPBenchMaps& Data, int32 Elements)
+{
+	for (int32 i = 0; i < Elements; ++i)
+	{
+		Data.IntToInt.Add(i, i * 31);
+		Data.StrToInt.Add(BenchString(i), i);
+		Data.NameToVec.Add(FName(TEXT("GMPBenchKey"), i), FVector(i, i, i));
+		FillLeaf(Data.IntToLeaf.Add(i), i);
+	}
+}
+
+// ---- codecs ----------------------------------------------------------------
+// Encode(Data, Out) fills Out with the wire bytes, Decode(In, Data) restores a default constructed instance
+struct FJsonCodec
+{
+	static const TCHAR* Name() { return TEXT("json"); }
+	template<typename T>
+	static bool Encode(const T& Data, TArray<uint8>& Out)
+	{
+		Out.Reset();
+		GMP::Json::UStructToJson(Out, Data);
+		return Out.Num() > 0;
+	}
+	template<typename T>
+	static bool Decode(const TArray<uint8>& In, T& Data)
+	{
+		return GMP::Json::UStructFromJson(TArrayView<const uint8>(In), Data);
+	}
+};
+
+#if defined(GMP_WITH_UPB)
+// only structs that have a registered proto descriptor can be encoded, others are reported as skipped
+struct FProtoCodec
+{
+	static const TCHAR* Name() { return TEXT("proto"); }
+	template<typename T>
+	static bool Encode(const T& Data, TArray<uint8>& Out)
+	{
+		Out.Reset();
+		return GMP::Proto::UStructToProto(Out, Data);
+	}
+	template<typename T>
+	static bool Decode(const TArray<uint8>& In, T& Data)
+	{
+		return GMP::Proto::UStructFromProto(TConstArrayView<uint8>(In), Data);
+	}
+};
+#endif
+
+// the TArgsSerializer<FArchive> path used by message payloads (TArchiveSerializer -> SerializeItem)
+struct FArchiveCodec
+{
+	static const TCHAR* Name() { return TEXT("archive"); }
+	template<typename T>
+	static bool Encode(const T& Data, TArray<uint8>& Out)
+	{
+		Out.Reset();
+		FMemoryWriter Writer(Out);
+		GMP::Serializer::TArgsSerializer<FArchive>::SerializeArgs(Writer, std::index_sequence<0>{}, const_cast<T&>(Data));
+		return !Writer.IsError();
+	}
+	template<typename T>
+	static bool Decode(const TArray<uint8>& In, T& Data)
+	{
+		FMemoryReader Reader(In);
+		GMP::Serializer::TArgsSerializer<FArchive>::SerializeArgs(Reader, std::index_sequence<0>{}, Data);
+		return !Reader.IsError();
+	}
+};
+
+// the same TArgsSerializer path over the net bit archives used by the RPC frames
+struct FNetBitsCodec
+{
+	static const TCHAR* Name() { return TEXT("netbits"); }
+	template<typename T>
+	static bool Encode(const T& Data, TArray<uint8>& Out)
+	{
+		FGMPNetBitWriter Writer(static_cast<UPackageMap*>(nullptr), 0);
+		GMP::Serializer::TArgsSerializer<FArchive>::SerializeArgs(Writer, std::index_sequence<0>{}, const_cast<T&>(Data));
+		if (Writer.IsError())
+			return false;
+		Out.Reset();
+		Out.Append(Writer.GetData(), Writer.GetNumBytes());
+		return true;
+	}
+	template<typename T>
+	static bool Decode(const TArray<uint8>& In, T& Data)
+	{
+		// trailing pad bits of the last byte are never consumed
+		FGMPNetBitReader Reader(static_cast<UPackageMap*>(nullptr), const_cast<uint8*>(In.GetData()), In.Num() * 8);
+		GMP::Serializer::TArgsSerializer<FArchive>::SerializeArgs(Reader, std::index_sequence<0>{}, Data);
+		return !Reader.IsError();
+	}
+};
+
+template<typename CodecType, typename T>
+static void RunCodec(const FBenchConfig& Cfg, const TCHAR* FixtureName, const T& Source, int32 Elements, TArray<FBenchResult>& Results)
+{
+	const FString Prefix = FString::Printf(TEXT("%s.%s"), FixtureName, CodecType::Name());
+	if (!Cfg.Accept(*Prefix))
+		return;
+
+	TArray<uint8> Wire;
+	if (!CodecType::Encode(Source, Wire))
+	{
+		UE_LOG(LogGMPBench, Display, TEXT("[Bench] %s skipped: codec cannot encode %s"), *Prefix, *TypeTraits::StaticStruct<T>()->GetName());
+		return;
+	}
+	{
+		T Probe;
+		if (!CodecType::Decode(Wire, Probe))
+		{
+			UE_LOG(LogGMPBench, Warning, TEXT("[Bench] %s skipped: round trip failed"), *Prefix);
+			return;
+		}
+	}
+
+	const double WireBytes = Wire.Num();
+	const int64 Ops = FMath::Max<int64>(1, Cfg.Iters / FMath::Max(1, Elements));
+	auto AddThroughput = [&](FBenchResult&& Result) {
+		Result.Metrics.Emplace(TEXT("wire_bytes"), WireBytes);
+		Result.Metrics.Emplace(TEXT("mb_per_s"), Result.P50Ns > 0.0 ? WireBytes * 1e3 / Result.P50Ns : 0.0);
+		AddResult(Results, MoveTemp(Result));
+	};
+
+	TArray<uint8> Buffer;
+	AddThroughput(Measure(Cfg, *(Prefix + TEXT(".encode")), {{TEXT("elements"), Elements}}, Ops, [&](int64 InOps) {
+		for (int64 i = 0; i < InOps; ++i)
+			CodecType::Encode(Source, Buffer);
+	}));
+	AddThroughput(Measure(Cfg, *(Prefix + TEXT(".decode")), {{TEXT("elements"), Elements}}, Ops, [&](int64 InOps) {
+		for (int64 i = 0; i < InOps; ++i)
+		{
+			T Data;
+			CodecType::Decode(Wire, Data);
+		}
+	}));
+}
+
+template<typename T>
+static void RunFixture(const FBenchConfig& Cfg, const TCHAR* FixtureName, int32 Elements, TArray<FBenchResult>& Results)
+{
+	T Source;
+	FillFixture(Source, Elements);
+	RunCodec<FJsonCodec>(Cfg, FixtureName, Source, Elements, Results);
+#if defined(GMP_WITH_UPB)
+	RunCodec<FProtoCodec>(Cfg, FixtureName, Source, Elements, Results);
+#endif
+	RunCodec<FArchiveCodec>(Cfg, FixtureName, Source, Elements, Results);
+	RunCodec<FNetBitsCodec>(Cfg, FixtureName, Source, Elements, Results);
+}
+
+static void RunSerializerSuite(const FBenchConfig& Cfg, const FString& Params, TArray<FBenchResult>& Results)
+{
+	TArray<int32> ElementCounts{16, 256};
+	ParseIntList(Params, TEXT("Elements="), ElementCounts);
+	for (int32 Elements : ElementCounts)
+	{
+		Elements = FMath::Max(Elements, 1);
+		RunFixture<FGMPBenchWide>(Cfg, TEXT("wide"), Elements, Results);
+		RunFixture<FGMPBenchNested>(Cfg, TEXT("nested"), Elements, Results);
+		RunFixture<FGMPBenchArrays>(Cfg, TEXT("arrays"), Elements, Results);
+		RunFixture<FGMPBenchMaps>(Cfg, TEXT("maps"), Elements, Results);
+	}
+}
+
+// ---- regression gate -------------------------------------------------------
+// -Baseline=<report.json> compares every result with the same id: p50 may grow by at most -MaxRegression percent
+// (default 10) and allocations per op by at most -MaxAllocRegression (default 0.5). Returns the number of regressions.
+static int32 CompareBaseline(const FString& Params, const TCHAR* Suite, const TArray<FBenchResult>& Results)
+{
+	FString BaselinePath;
+	if (!ParseSuitePath(Params, TEXT("Baseline="), Suite, BaselinePath))
+		return 0;
+
+	float MaxRegression = 10.f;
+	float MaxAllocRegression = 0.5f;
+	FParse::Value(*Params, TEXT("MaxRegression="), MaxRegression);
+	FParse::Value(*Params, TEXT("MaxAllocRegression="), MaxAllocRegression);
+
+	FGMPValueOneOf Baseline;
+	TArray<FGMPValueOneOf> Entries;
+	if (!Baseline.LoadFromFile(BaselinePath) || !Baseline.AsValue(Entries, TEXT("results")))
+	{
+		UE_LOG(LogGMPBench, Error, TEXT("[Bench] cannot read baseline %s"), *BaselinePath);
+		return 1;
+	}
+
+	struct FBaselineEntry
+	{
+		double P50Ns = 0.0;
+		double AllocsPerOp = -1.0;
+	};
+	TMap<FString, FBaselineEntry> BaselineMap;
+	for (auto& Entry : Entries)
+	{
+		FString Id;
+		FBaselineEntry Value;
+		if (Entry.AsValue(Id, TEXT("id")) && Entry.AsValue(Value.P50Ns, TEXT("p50_ns")))
+		{
+			Entry.AsValue(Value.AllocsPerOp, TEXT("allocs_per_op"));
+			BaselineMap.Add(Id, Value);
+		}
+	}
+
+	int32 Regressions = 0;
+	for (auto& Result : Results)
+	{
+		const FString Id = Result.GetId();
+		const FBaselineEntry* Base = BaselineMap.Find(Id);
+		if (!Base)
+			continue;
+		if (Base->P50Ns > 0.0 && (Result.P50Ns - Base->P50Ns) / Base->P50Ns * 100.0 > MaxRegression)
+		{
+			UE_LOG(LogGMPBench, Error, TEXT("[Bench] REGRESSION %s p50 %.1fns -> %.1fns (limit +%.1f%%)"), *Id, Base->P50Ns, Result.P50Ns, MaxRegression);
+			++Regressions;
+		}
+		if (Base->AllocsPerOp >= 0.0 && Result.AllocsPerOp >= 0.0 && Result.AllocsPerOp - Base->AllocsPerOp > MaxAllocRegression)
+		{
+			UE_LOG(LogGMPBench, Error, TEXT("[Bench] REGRESSION %s allocs/op %.3f -> %.3f (limit +%.3f)"), *Id, Base->AllocsPerOp, Result.AllocsPerOp, MaxAllocRegression);
+			++Regressions;
+		}
+	}
+	UE_LOG(LogGMPBench, Display, TEXT("[Bench] baseline %s: %d regression(s)"), *BaselinePath, Regressions);
+	return Regressions;
+}
+}  // namespace Bench
+
+int32 RunGMPBenchmarks(const FString& Params)
+{
+	using namespace Bench;
+	const FBenchConfig Cfg = ParseConfig(Params);
+	FString Suite = TEXT("All");
+	FParse::Value(*Params, TEXT("Suite="), Suite);
+
+	int32 Failures = 0;
+	if (Suite == TEXT("All") || Suite == TEXT("Dispatch"))
+	{
+		UE_LOG(LogGMPBench, Display, TEXT("==== GMP Dispatch Benchmark (FLEX=%d INLINE_FIRE=%d DIRECT=%d) ===="), int32(GMP_SIGNAL_BACKEND_FLEX), int32(GMP_WITH_INLINE_FIRE), int32(GMP_WITH_DIRECT_SIGNAL));
+		TArray<FBenchResult> Results;
+		RunDispatchSuite(Cfg, Results);
+		Failures += WriteReport(Params, TEXT("Dispatch"), Cfg, Results) ? 0 : 1;
+		Failures += CompareBaseline(Params, TEXT("Dispatch"), Results);
+	}
+	if (Suite == TEXT("All") || Suite == TEXT("Serializer"))
+	{
+		UE_LOG(LogGMPBench, Display, TEXT("==== GMP Serializer Benchmark ===="));
+		TArray<FBenchResult> Results;
+		RunSerializerSuite(Cfg, Params, Results);
+		Failures += WriteReport(Params, TEXT("Serializer"), Cfg, Results) ? 0 : 1;
+		Failures += CompareBaseline(Params, TEXT("Serializer"), Results);
+	}
+	return Failures;
+}
+}  // namespace GMPUnitTest
@@ -6,9 +6,11 @@
 
 #include "Algo/BinarySearch.h"
 #include "Algo/ForEach.h"
+#include "GMPMemoryStats.h"
 #include "GMPMeta.h"
 #include "GMPSignalsImpl.h"
 #include "GMPSignalsInc.h"
+#include "GMPTrace.h"
 #include "GMPUtils.h"
 #include "GMPWorldLocals.h"
 #include "HAL/ThreadSingleton.h"
@@ -60,6 +62,14 @@ FXConsoleVariableRef CVar_EnableGMPListeningLog(TEXT("GMP.EnableLogging"), GEnab
 int32 GWarningNoListeners = 0;
 FXConsoleVariableRef CVar_EnableGMPNoListenersLog(TEXT("GMP.EnableNoListenerLog"), GWarningNoListeners, TEXT(""));
 
+#if UE_5_00_OR_LATER
+// children name their parent explicitly so LLM reports nest them as GMP/Signals etc. instead of listing them flat
+LLM_DEFINE_TAG(GMP);
+LLM_DEFINE_TAG(GMP_Signals, TEXT("GMP/Signals"), TEXT("GMP"));
+LLM_DEFINE_TAG(GMP_Holders, TEXT("GMP/Holders"), TEXT("GMP"));
+LLM_DEFINE_TAG(GMP_Responses, TEXT("GMP/Responses"), TEXT("GMP"));
+#endif
+
 namespace GMP
 {
 #if GMP_WITH_MSG_HOLDER
@@ -225,6 +235,7 @@ namespace GMP
 		auto Holder = SignalPtr->Store;  // keep the dynamic store alive across the fire
 		return GMPFireWithSigSourceDirectRaw(Holder.Get(), InSigSrc, P.GetData(), static_cast<const FGMPExtra*>(&Msg));
 #else
+		FMessageSendScope SendScope;
 		return SignalPtr->FireWithSigSource(InSigSrc, Msg);
 #endif
 	}
@@ -232,6 +243,7 @@ namespace GMP
 	FORCEINLINE_DEBUGGABLE static void InvokeSlotMsgBodyAdapt(FSigElm* Elem, FSigSource InSigSrc, FMessageBody& Msg)
 	{
 		Elem->CheckCallable();
+		FMessageSendScope SendScope;
 #if GMP_WITH_DIRECT_SIGNAL
 		const auto P = Msg.GetParams();
 		FArrayTypeNames TypeNamesStk;
@@ -355,6 +367,48 @@ namespace GMP
 	}
 #endif
 
+	namespace TypedAddrPool
+	{
+		// arrays that grew past this are freed instead of pooled, one oversized send should not pin its memory
+		constexpr int32 MaxPooledCapacity = 64;
+		constexpr int32 MaxPooledArrays = 16;
+
+		struct FPool
+		{
+			TArray<TArray<FGMPTypedAddr>*, TInlineAllocator<MaxPooledArrays>> Free;
+			~FPool()
+			{
+				for (auto* Arr : Free)
+					delete Arr;
+			}
+		};
+		static FPool& Get()
+		{
+			static thread_local FPool Pool;
+			return Pool;
+		}
+	}  // namespace TypedAddrPool
+
+	FPooledTypedAddrArray::FPooledTypedAddrArray()
+	{
+		auto& Free = TypedAddrPool::Get().Free;
+		Arr = Free.Num() ? Free.Pop(EAllowShrinking::No) : new TArray<FGMPTypedAddr>();
+	}
+
+	FPooledTypedAddrArray::~FPooledTypedAddrArray()
+	{
+		auto& Free = TypedAddrPool::Get().Free;
+		if (Free.Num() < TypedAddrPool::MaxPooledArrays && Arr->Max() <= TypedAddrPool::MaxPooledCapacity)
+		{
+			Arr->Reset();
+			Free.Add(Arr);
+		}
+		else
+		{
+			delete Arr;
+		}
+	}
+
 #if WITH_EDITOR
 	FString FMessageBody::MessageToString() const
 	{
@@ -458,6 +512,10 @@ namespace GMP
 		};
 #endif
 
+		// bumped whenever a registered send/recv signature is added, refined or dropped, it invalidates every
+		// FSignalStore::SigCheckMemo at once; IsSignatureCompatible may bump it off the game thread
+		static std::atomic<uint32> SignatureEpoch{0};
+
 		template<bool bSingleShot>
 		auto& GetSends()
 		{
@@ -555,9 +613,13 @@ namespace GMP
 		{
 			// R/R contract: Seq (GMPResponses key) must cross the fire via extra->Seq to the responder, else R/R mismatches.
 			const FGMPKey Seq = OnRsp.GetId();
-			Hub::GMPResponses().Emplace(Seq, MoveTemp(OnRsp));
+			{
+				GMP_LLM_SCOPE(GMP_Responses);
+				Hub::GMPResponses().Emplace(Seq, MoveTemp(OnRsp));
+			}
 
 			auto SignalPtr = static_cast<FGMPMsgSignal*>(Ptr);
+			GMP_TRACE_SEND_SCOPE(MessageKey, InSigSrc, Param.Num(), SingleshotTypes ? SingleshotTypes->GetData() : nullptr);
 #if GMP_WITH_DIRECT_SIGNAL
 			FArrayTypeNames TypeNamesStk;
 			const FName* TypeNamesPtr = nullptr;
@@ -935,6 +997,7 @@ namespace GMP
 		GMP_MSGBODY_ON_STACK(Msg, Params.Num(), Params.GetData(), MessageKey, InSigSrc, FGMPKey{});
 		auto Seq = Msg.Sequence();
 		{
+			GMP_TRACE_SEND_SCOPE(MessageKey, InSigSrc, Params.Num(), Msg.TypeNames);
 			auto SignalPtr = static_cast<FGMPMsgSignal*>(Ptr);
 #if WITH_EDITOR
 			if (GIsEditor)
@@ -962,6 +1025,7 @@ namespace GMP
 #if !GMP_WITH_STATIC_STORE
 		auto Holder = DirectStore->AsShared();
 #endif
+		GMP_TRACE_SEND_SCOPE(extra->Key, InSigSrc, extra->Size, extra->TypeNames);
 		GMPFireWithSigSourceDirectRaw(DirectStore, InSigSrc, paddrs, extra);
 	}
 
@@ -972,6 +1036,7 @@ namespace GMP
 		if (GIsEditor)
 		{
 			GMP_MSGBODY_ON_STACK(Msg, Param.Num(), Param.GetData(), MessageKey, InSigSrc, FGMPKey{});
+			GMP_TRACE_SEND_SCOPE(MessageKey, InSigSrc, Param.Num(), Msg.TypeNames);
 			Hub::FRecursionDetection Detector(MessageKey, InSigSrc);
 			auto IDs = FireMsgBodyAdapt(SignalPtr, InSigSrc, Msg);
 			Hub::AccumulateInvokes(MessageKey, IDs);
@@ -982,6 +1047,7 @@ namespace GMP
 		FArrayTypeNames TypeNamesStk;
 		const FName* TypeNamesPtr = EnsureMsgTypeNames(Param, MessageKey, InSigSrc, TypeNamesStk);
 		const FGMPExtra Extra{Param.Num(), 0.f, TypeNamesPtr, InSigSrc, MessageKey, FGMPKey{}};
+		GMP_TRACE_SEND_SCOPE(MessageKey, InSigSrc, Param.Num(), TypeNamesPtr);
 		auto Holder = SignalPtr->Store;
 		GMPFireWithSigSourceDirectRaw(Holder.Get(), InSigSrc, Param.GetData(), &Extra);
 		return true;
@@ -1259,6 +1325,7 @@ namespace GMP
 #if GMP_WITH_STATIC_STORE
 		GMPEnsureStaticStoreRegistered(Ptr->Store.Get());
 #endif
+		GMP_LLM_SCOPE(GMP_Holders);
 		auto Find = (StoreHasSourceMsgs(Ptr->Store.Get()) ? StoreSourceMsgs(Ptr->Store.Get()).Find(InSigSrc) : nullptr);
 		if (!Find)
 		{
@@ -1393,7 +1460,11 @@ namespace GMP
 		}
 		static void AssingIfPossible(FName& l, const FName& r)
 		{
-			l = r;
+			if (l != r)
+			{
+				l = r;
+				SignatureEpoch.fetch_add(1, std::memory_order_release);
+			}
 		}
 
 		struct FTagDefinition
@@ -1494,6 +1565,7 @@ namespace GMP
 					if (ParamMore)
 					{
 						PtrRecv = &Recvs.Emplace(MessageId, InTypes);
+						SignatureEpoch.fetch_add(1, std::memory_order_release);
 					}
 				}
 				else
@@ -1524,6 +1596,7 @@ namespace GMP
 					if (ParamLess)
 					{
 						PtrSend = &Sends.Emplace(MessageId, InTypes);
+						SignatureEpoch.fetch_add(1, std::memory_order_release);
 					}
 				}
 
@@ -1656,9 +1729,11 @@ namespace GMP
 #endif
 #if GMP_WITH_DIRECT_SIGNAL
 			const FGMPExtra Extra{Params.Num(), 0.f, nullptr, InSigSrc, Val.GetRec(), RequestSequence};
+			FMessageSendScope SendScope;
 			Val(Params.GetData(), &Extra);
 #else
 			GMP_MSGBODY_ON_STACK(Msg, Params.Num(), Params.GetData(), Val.GetRec(), InSigSrc, RequestSequence);
+			FMessageSendScope SendScope;
 			Val(Msg);
 #endif
 		}
@@ -1685,6 +1760,38 @@ namespace GMP
 		return true;
 	}
 
+	bool FMessageHub::IsSignatureCompatibleCached(FSignalStore* Store, const FName& MessageId, const FArrayTypeNames& StaticTypes, const TCHAR* TagType)
+	{
+#if GMP_WITH_DYNAMIC_CALL_CHECK
+		// the registry is game thread state, memo entries are only trusted (and written) there
+		const bool bMemo = Store && IsInGameThread();
+		if (bMemo)
+		{
+			const uint32 Epoch = Hub::SignatureEpoch.load(std::memory_order_acquire);
+			for (const auto& Memo : Store->SigCheckMemo)
+			{
+				if (Memo.SenderTypes == &StaticTypes && Memo.Epoch == Epoch)
+					return true;
+			}
+		}
+
+		const FArrayTypeNames* OldTypes = nullptr;
+		if (!IsSignatureCompatible(true, MessageId, StaticTypes, OldTypes, TagType))
+			return false;
+
+		if (bMemo)
+		{
+			// read the epoch after the check, registering these types may have bumped it
+			auto& Memos = Store->SigCheckMemo;
+			const uint32 Epoch = Hub::SignatureEpoch.load(std::memory_order_acquire);
+			if (Memos.Num() >= 8 || (Memos.Num() && Memos[0].Epoch != Epoch))
+				Memos.Reset();
+			Memos.Add({&StaticTypes, Epoch});
+		}
+#endif
+		return true;
+	}
+
 	bool FMessageHub::IsSingleshotCompatible(bool bCall, const FName& MessageId, const FArrayTypeNames& TypeNames, const FArrayTypeNames*& OldTypes, const TCHAR* TagType)
 	{
 #if GMP_WITH_DYNAMIC_CALL_CHECK
@@ -1725,6 +1832,140 @@ namespace GMP
 #endif
 	}
 
+	namespace MemoryStats
+	{
+		FGMPMemorySummary CollectKeyMemory(TArray<FGMPKeyMemory>& Out)
+		{
+			FGMPMemorySummary Summary;
+			TMap<FName, FGMPKeyMemory> KeyMap;
+			GMPForEachSignalStore([&](FSignalStore& Store) {
+				auto& Info = KeyMap.FindOrAdd(Store.MessageKey);
+				Info.Key = Store.MessageKey;
+				++Info.Stores;
+				const int32 Listeners = Store.GetListenerNum();
+				const int32 Stale = Store.GetStaleKeys().Num();
+				SIZE_T CallableBytes = 0;
+				const SIZE_T StoreBytes = sizeof(FSignalStore) + Store.GetAllocatedSize(&CallableBytes);
+				Info.Listeners += Listeners;
+				Info.StaleListeners += Stale;
+				Info.StoreBytes += StoreBytes;
+				Info.CallableBytes += CallableBytes;
+
+#if GMP_WITH_MSG_HOLDER
+				if (StoreHasSourceMsgs(&Store))
+				{
+					const auto& Msgs = StoreSourceMsgs(&Store);
+					SIZE_T HolderBytes = Msgs.GetAllocatedSize();
+					for (auto& Pair : Msgs)
+					{
+						int32 Num = 0;
+						if (auto StructType = Pair.Value.GetTypeAndNum(Num))
+							HolderBytes += StructType->GetStructureSize() * Num;
+					}
+					Info.HeldMessages += Msgs.Num();
+					Info.HolderBytes += HolderBytes;
+					Summary.HolderBytes += HolderBytes;
+				}
+#endif
+				++Summary.Stores;
+				Summary.Listeners += Listeners;
+				Summary.StaleListeners += Stale;
+				Summary.StoreBytes += StoreBytes;
+				Summary.CallableBytes += CallableBytes;
+			});
+
+			Summary.MappingBytes = GMPGetSourceMappingSize(&Summary.SourceMappings, &Summary.ExtKeys);
+			Summary.Responses = Hub::GMPResponses().Num();
+			Summary.ResponseBytes = Hub::GMPResponses().GetAllocatedSize();
+
+			KeyMap.GenerateValueArray(Out);
+			Out.Sort([](const FGMPKeyMemory& Lhs, const FGMPKeyMemory& Rhs) { return Lhs.GetTotalBytes() > Rhs.GetTotalBytes(); });
+			return Summary;
+		}
+
+		int32 CollectStaleListeners(TArray<FGMPStaleListener>& Out)
+		{
+			const int32 OldNum = Out.Num();
+			GMPForEachSignalStore([&](FSignalStore& Store) {
+				for (auto Key : Store.GetStaleKeys())
+				{
+					auto Elem = Store.FindSigElm(Key);
+					Out.Add(FGMPStaleListener{Store.MessageKey, Key, Elem ? Elem->GetSource() : FSigSource::NullSigSrc});
+				}
+			});
+			return Out.Num() - OldNum;
+		}
+
+		int32 PurgeStaleListeners()
+		{
+			int32 Ret = 0;
+			GMPForEachSignalStore([&](FSignalStore& Store) { Ret += Store.PurgeStaleKeys(); });
+			return Ret;
+		}
+
+#if !UE_BUILD_SHIPPING
+		static void DumpKeyMemory(int32 Count)
+		{
+			if (Count <= 0)
+				Count = 20;
+
+			TArray<FGMPKeyMemory> Keys;
+			const FGMPMemorySummary Summary = CollectKeyMemory(Keys);
+			UE_LOG(LogGMP,
+				   Display,
+				   TEXT("GMP memory: total %llu bytes | stores %d (%llu bytes, callables %llu) listeners %d stale %d | holders %llu bytes | mappings %d ext-keys %d (%llu bytes) | responses %d (%llu bytes)"),
+				   (uint64)Summary.GetTotalBytes(),
+				   Summary.Stores,
+				   (uint64)Summary.StoreBytes,
+				   (uint64)Summary.CallableBytes,
+				   Summary.Listeners,
+				   Summary.StaleListeners,
+				   (uint64)Summary.HolderBytes,
+				   Summary.SourceMappings,
+				   Summary.ExtKeys,
+				   (uint64)Summary.MappingBytes,
+				   Summary.Responses,
+				   (uint64)Summary.ResponseBytes);
+
+			auto LogKeys = [&](const TCHAR* Title) {
+				UE_LOG(LogGMP, Display, TEXT("GMP top keys by %s (%d of %d):"), Title, FMath::Min(Count, Keys.Num()), Keys.Num());
+				for (int32 i = 0; i < Keys.Num() && i < Count; ++i)
+				{
+					auto& Info = Keys[i];
+					UE_LOG(LogGMP,
+						   Display,
+						   TEXT("  %-48s bytes:%8llu store:%8llu callables:%8llu holders:%8llu(%d) listeners:%5d stale:%5d"),
+						   *Info.Key.ToString(),
+						   (uint64)Info.GetTotalBytes(),
+						   (uint64)Info.StoreBytes,
+						   (uint64)Info.CallableBytes,
+						   (uint64)Info.HolderBytes,
+						   Info.HeldMessages,
+						   Info.Listeners,
+						   Info.StaleListeners);
+				}
+			};
+			LogKeys(TEXT("bytes"));
+			Keys.Sort([](const FGMPKeyMemory& Lhs, const FGMPKeyMemory& Rhs) { return Lhs.Listeners > Rhs.Listeners; });
+			LogKeys(TEXT("listeners"));
+		}
+
+		static void DumpStaleListeners(bool bPurge)
+		{
+			TArray<FGMPStaleListener> Stales;
+			CollectStaleListeners(Stales);
+			for (auto& Stale : Stales)
+				UE_LOG(LogGMP, Warning, TEXT("GMP stale listener Key[%s] Id[%lld] Src[%s]: handler destroyed without disconnect"), *Stale.Key.ToString(), (int64)Stale.Id, *Stale.Source.GetNameSafe());
+			UE_LOG(LogGMP, Display, TEXT("GMP stale listeners: %d"), Stales.Num());
+			if (bPurge && Stales.Num() > 0)
+				UE_LOG(LogGMP, Display, TEXT("GMP stale listeners purged: %d"), PurgeStaleListeners());
+		}
+
+		FXConsoleCommandLambda XVar_GMPMemDump(TEXT("gmp.mem.dump"), [](int32 InCount, UWorld* InWorld) { DumpKeyMemory(InCount); });
+		FXConsoleCommandLambda XVar_GMPMemStale(TEXT("gmp.mem.stale"), [](bool bPurge, UWorld* InWorld) { DumpStaleListeners(bPurge); });
+#endif
+	}  // namespace MemoryStats
+
 #if GMP_WITH_DYNAMIC_CALL_CHECK
 	namespace DirectTyped
 	{
@@ -1742,6 +1983,7 @@ namespace
 #if GMP_WITH_DYNAMIC_CALL_CHECK
 		{
 			FCoreUObjectDelegates::PreLoadMap.AddLambda([](const FString& MapName) {
+				GMP::Hub::SignatureEpoch.fetch_add(1, std::memory_order_release);
 				GMP::Hub::GetSends<true>().Empty();
 				GMP::Hub::GetRecvs<true>().Empty();
 				GMP::Hub::GetSends<false>().Empty();
@@ -1752,6 +1994,7 @@ namespace
 			if (GIsEditor)
 			{
 				FEditorDelegates::PreBeginPIE.AddLambda([](bool bIsSimulating) {
+					GMP::Hub::SignatureEpoch.fetch_add(1, std::memory_order_release);
 					GMP::Hub::GetSends<true>().Empty();
 					GMP::Hub::GetRecvs<true>().Empty();
 					GMP::Hub::GetSends<false>().Empty();
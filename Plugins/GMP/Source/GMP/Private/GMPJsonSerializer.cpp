@@ -574,6 +574,38 @@ namespace Json
 		return true;
 	}
 
+	bool OneOfFromJsonImpl(TArrayView<const uint8> In, FGMPValueOneOf& OutValue)
+	{
+#if WITH_GMPVALUE_ONEOF
+		const uint8* Data = In.GetData();
+		int32 Len = In.Num();
+		if (Len >= 3 && Data[0] == 0xEF && Data[1] == 0xBB && Data[2] == 0xBF)
+		{
+			Data += 3;
+			Len -= 3;
+		}
+		else if (Len >= 2 && ((Data[0] == 0xFF && Data[1] == 0xFE) || (Data[0] == 0xFE && Data[1] == 0xFF)))
+		{
+			return false;
+		}
+		if (Len <= 0)
+			return false;
+
+		using namespace rapidjson;
+		using DocType = Detail::TGenericDocument<UTF8<uint8>>;
+		auto Ref = MakeShared<DocType, ESPMode::ThreadSafe>();
+		Ref->Parse<kParseStopWhenDoneFlag | kParseCommentsFlag | kParseTrailingCommasFlag>(Data, Len);
+		if (Ref->HasParseError())
+			return false;
+		auto& Holder = FriendGMPValueOneOf(OutValue);
+		Holder.Flags = sizeof(uint8);
+		Holder.Value = MoveTemp(Ref);
+		return true;
+#else
+		return false;
+#endif
+	}
+
 	bool PropFromJsonImpl(FString&& In, FProperty* Prop, void* ContainerAddr)
 	{
 		if (In.Len() == 0)
@@ -1077,6 +1109,101 @@ bool UGMPJsonUtils::AsValueImpl(const FGMPValueOneOf& In, FProperty* Prop, void*
 	return bRet;
 }
 
+namespace GMP
+{
+namespace Json
+{
+	namespace Detail
+	{
+		template<typename CharType>
+		struct TPathKey;
+		template<>
+		struct TPathKey<uint8>
+		{
+			static const uint8* Get(const FGMPValuePath::FSegment& Segment, int32& OutLen)
+			{
+				OutLen = Segment.Utf8.Num();
+				return Segment.Utf8.GetData();
+			}
+			static bool Equals(const uint8* Lhs, const uint8* Rhs, int32 Len) { return FCStringAnsi::Strnicmp((const ANSICHAR*)Lhs, (const ANSICHAR*)Rhs, Len) == 0; }
+		};
+		template<>
+		struct TPathKey<TCHAR>
+		{
+			static const TCHAR* Get(const FGMPValuePath::FSegment& Segment, int32& OutLen)
+			{
+				OutLen = Segment.Str.Len();
+				return *Segment.Str;
+			}
+			static bool Equals(const TCHAR* Lhs, const TCHAR* Rhs, int32 Len) { return FCString::Strnicmp(Lhs, Rhs, Len) == 0; }
+		};
+
+		// same matching as JsonUtils::FindMember (case-insensitive, first hit) but against the pre-encoded key,
+		// so no FName is made per member and mismatched lengths are rejected up front
+		template<typename ValueType>
+		const ValueType* FindPathMember(const ValueType& Val, const FGMPValuePath::FSegment& Segment)
+		{
+			if (Segment.Key.IsNone())
+				return &Val;
+			if (!Val.IsObject())
+				return nullptr;
+
+			using CharType = typename ValueType::Ch;
+			int32 KeyLen = 0;
+			const CharType* Key = TPathKey<CharType>::Get(Segment, KeyLen);
+			for (auto& Pair : Val.GetObject())
+			{
+				if ((int32)Pair.name.GetStringLength() == KeyLen && TPathKey<CharType>::Equals(Pair.name.GetString(), Key, KeyLen))
+					return &Pair.value;
+			}
+			return nullptr;
+		}
+
+		template<typename ValueType>
+		bool ReadPathValue(const ValueType& Root, const FGMPValuePath& Path, FProperty* Prop, void* Out)
+		{
+			const ValueType* Val = &Root;
+			for (int32 Idx = 0; Val && Idx < Path.Num(); ++Idx)
+				Val = FindPathMember(*Val, Path.GetSegment(Idx));
+			return Val && !Val->IsNull() && ReadFromJson(*Val, Prop, Out);
+		}
+	}  // namespace Detail
+}  // namespace Json
+}  // namespace GMP
+
+bool UGMPJsonUtils::AsValueImpl(const FGMPValueOneOf& In, FProperty* Prop, void* Out, const FGMPValuePath& Path)
+{
+	bool bRet = false;
+	do
+	{
+		auto OneOfPtr = &GMP::Json::FriendGMPValueOneOf(In);
+
+		if (!OneOfPtr->IsValid())
+			break;
+
+#if WITH_GMPVALUE_ONEOF
+		if (OneOfPtr->Flags == sizeof(uint8))
+		{
+			using DocType = GMP::Json::Detail::TGenericDocument<rapidjson::UTF8<uint8>>;
+			auto Ptr = StaticCastSharedPtr<DocType>(OneOfPtr->Value);
+			bRet = GMP::Json::Detail::ReadPathValue(static_cast<DocType::ValueType&>(*Ptr), Path, Prop, Out);
+		}
+		else if (OneOfPtr->Flags == sizeof(TCHAR))
+		{
+			using DocType = GMP::Json::Detail::TGenericDocument<rapidjson::UTF16LE<TCHAR>>;
+			auto Ptr = StaticCastSharedPtr<DocType>(OneOfPtr->Value);
+			bRet = GMP::Json::Detail::ReadPathValue(static_cast<DocType::ValueType&>(*Ptr), Path, Prop, Out);
+		}
+		else
+		{
+			bool bUnreachable = false;
+			(void)GMP_ENSURE_JSON(bUnreachable);
+		}
+#endif
+	} while (false);
+	return bRet;
+}
+
 void UGMPJsonUtils::ClearOneOf(FGMPValueOneOf& OneOf)
 {
 	OneOf.Clear();
@@ -43,6 +43,7 @@ public:
 
 protected:
 	static bool AsValueImpl(const FGMPValueOneOf& In, FProperty* Prop, void* Out, FName SubKey);
+	static bool AsValueImpl(const FGMPValueOneOf& In, FProperty* Prop, void* Out, const FGMPValuePath& Path);
 	static int32 IterateKeyValueImpl(const FGMPValueOneOf& In, int32 Idx, FString& OutKey, FGMPValueOneOf& OutValue);
 
 	friend struct FGMPValueOneOf;
@@ -2,6 +2,7 @@
 
 #include "GMPLocalSharedStorage.h"
 #include "GMPLocalSharedStorageInternal.h"
+#include "GMPUtils.h"
 #include "GMPWorldLocals.h"
 
 #if GMP_WITH_MSG_HOLDER
@@ -89,42 +90,37 @@ void ULocalSharedStorageInternal::AddReferencedObjects(UObject* InThis, FReferen
 			Holder.AddStructReferencedObjects(Collector);
 		}
 	}
+	for (auto& Pair : This->Slots)
+	{
+		Collector.AddReferencedObject(Pair.Value->Object);
+	}
 }
 
-bool ULocalSharedStorage::SetLocalSharedStorageImpl(const UObject* InCtx, FName Key, ELocalSharedOverrideMode Mode, const FProperty* Prop, const void* Data)
+bool ULocalSharedStorageInternal::SetValue(FName Key, ELocalSharedOverrideMode Mode, const FProperty* Prop, const void* Data)
 {
-	auto Mgr = GetInternal(InCtx);
-
 	if (auto StructProp = CastField<FStructProperty>(Prop))
 	{
-		FInstancedStruct* Find = Mgr->StructMap.Find(Key);
+		FInstancedStruct* Find = StructMap.Find(Key);
 		if (!Find || Mode == ELocalSharedOverrideMode::Override)
 		{
-			Mgr->StructMap.FindOrAdd(Key).InitializeAs(StructProp->Struct, (const uint8*)Data);
+			StructMap.FindOrAdd(Key).InitializeAs(StructProp->Struct, (const uint8*)Data);
 			return true;
 		}
 	}
 	else if (auto ObjPropBase = CastField<FObjectProperty>(Prop))
 	{
-		auto* ObjPtr = Mgr->ObjectMap.Find(Key);
+		auto* ObjPtr = ObjectMap.Find(Key);
 		if (!ObjPtr || Mode == ELocalSharedOverrideMode::Override)
 		{
-			Mgr->ObjectMap.FindOrAdd(Key) = *(UObject**)Data;
+			ObjectMap.FindOrAdd(Key) = *(UObject**)Data;
 			return true;
 		}
 	}
 	else
 	{
-		ULocalSharedStorageInternal::FPropertyStorePtr& StorePtr = Mgr->PropertyStores.FindOrAdd(Key);
+		FPropertyStorePtr& StorePtr = PropertyStores.FindOrAdd(Key);
 		if (!StorePtr.IsValid() || Mode == ELocalSharedOverrideMode::Override)
 		{
-			static auto GetElementSize = [](const FProperty* Prop) {
-#if UE_5_05_OR_LATER
-				return Prop->GetElementSize();
-#else
-				return Prop->ElementSize;
-#endif
-			};
 			StorePtr.Reset(FGMPPropHeapHolder::MakePropHolder(Prop, Data, nullptr));
 			return true;
 		}
@@ -132,26 +128,33 @@ bool ULocalSharedStorage::SetLocalSharedStorageImpl(const UObject* InCtx, FName
 	return false;
 }
 
-void* ULocalSharedStorage::GetLocalSharedStorageImpl(const UObject* InCtx, FName Key, const FProperty* Prop)
+bool ULocalSharedStorageInternal::RemoveValue(FName Key)
+{
+	bool bRemoved = StructMap.Remove(Key) > 0;
+	bRemoved |= ObjectMap.Remove(Key) > 0;
+	bRemoved |= PropertyStores.Remove(Key) > 0;
+	return bRemoved;
+}
+
+void* ULocalSharedStorageInternal::FindValue(FName Key, const FProperty* Prop)
 {
-	auto Mgr = GetInternal(InCtx);
 	if (auto StructProp = CastField<FStructProperty>(Prop))
 	{
-		if (FInstancedStruct* Find = Mgr->StructMap.Find(Key))
+		if (FInstancedStruct* Find = StructMap.Find(Key))
 		{
 			return Find->GetMutableMemory();
 		}
 	}
 	else if (auto ObjProp = CastField<FObjectProperty>(Prop))
 	{
-		if (TObjectPtr<UObject>* ObjPtr = Mgr->ObjectMap.Find(Key))
+		if (TObjectPtr<UObject>* ObjPtr = ObjectMap.Find(Key))
 		{
 			return (*ObjPtr).Get();
 		}
 	}
 	else
 	{
-		if (ULocalSharedStorageInternal::FPropertyStorePtr* StorePtr = Mgr->PropertyStores.Find(Key))
+		if (FPropertyStorePtr* StorePtr = PropertyStores.Find(Key))
 		{
 			return (*StorePtr)->GetAddr();
 		}
@@ -159,6 +162,129 @@ void* ULocalSharedStorage::GetLocalSharedStorageImpl(const UObject* InCtx, FName
 	return nullptr;
 }
 
+void ULocalSharedStorageInternal::RefreshSlot(GMP::FLocalSharedSlotData& Slot)
+{
+	// unlike FindValue the stored type is checked here, a slot never points at a value of another type
+	Slot.Addr = nullptr;
+	Slot.Object = nullptr;
+	if (auto StructProp = CastField<FStructProperty>(Slot.Prop))
+	{
+		FInstancedStruct* Find = StructMap.Find(Slot.Key);
+		if (Find && Find->GetScriptStruct() == StructProp->Struct)
+			Slot.Addr = Find->GetMutableMemory();
+	}
+	else if (auto ObjProp = CastField<FObjectProperty>(Slot.Prop))
+	{
+		TObjectPtr<UObject>* ObjPtr = ObjectMap.Find(Slot.Key);
+		if (ObjPtr && (!*ObjPtr || (*ObjPtr)->IsA(ObjProp->PropertyClass)))
+		{
+			Slot.Object = ObjPtr->Get();
+			Slot.Addr = &Slot.Object;
+		}
+	}
+	else
+	{
+		FPropertyStorePtr* StorePtr = PropertyStores.Find(Slot.Key);
+		if (StorePtr && StorePtr->IsValid() && (*StorePtr)->GetProp()->SameType(Slot.Prop))
+			Slot.Addr = (*StorePtr)->GetAddr();
+	}
+}
+
+void ULocalSharedStorageInternal::OnValueSet(GMP::FLocalSharedSlotData& Slot)
+{
+	++Slot.Version;
+	if (!Slot.NotifyKey.IsNone())
+		GMP::FMessageUtils::GetMessageHub()->SendObjectMessage(FMSGKEYFind(FMSGKEY(Slot.NotifyKey)), this, Slot.Key, static_cast<int32>(Slot.Version));
+}
+
+bool ULocalSharedStorage::SetLocalSharedStorageImpl(const UObject* InCtx, FName Key, ELocalSharedOverrideMode Mode, const FProperty* Prop, const void* Data)
+{
+	auto Mgr = GetInternal(InCtx);
+	if (!Mgr->SetValue(Key, Mode, Prop, Data))
+		return false;
+
+	if (auto Slot = Mgr->Slots.Find(Key))
+	{
+		Mgr->RefreshSlot(**Slot);
+		Mgr->OnValueSet(**Slot);
+	}
+	return true;
+}
+
+void* ULocalSharedStorage::GetLocalSharedStorageImpl(const UObject* InCtx, FName Key, const FProperty* Prop)
+{
+	auto Mgr = GetInternal(InCtx);
+	return Mgr->FindValue(Key, Prop);
+}
+
+UObject* ULocalSharedStorage::GetStorageSource(const UObject* InCtx)
+{
+	return GetInternal(InCtx);
+}
+
+bool ULocalSharedStorage::RemoveLocalSharedStorage(const UObject* InCtx, FName Key)
+{
+	auto Mgr = GetInternal(InCtx);
+	if (!Mgr->RemoveValue(Key))
+		return false;
+
+	if (auto Slot = Mgr->Slots.Find(Key))
+	{
+		Mgr->RefreshSlot(**Slot);
+		Mgr->OnValueSet(**Slot);
+	}
+	return true;
+}
+
+TSharedPtr<GMP::FLocalSharedSlotData> ULocalSharedStorage::FindOrAddSlotImpl(const UObject* InCtx, FName Key, const FProperty* Prop, FName NotifyKey, TWeakObjectPtr<UObject>& OutStorage)
+{
+	auto Mgr = GetInternal(InCtx);
+	if (!Mgr || !Prop)
+		return nullptr;
+
+	TSharedPtr<GMP::FLocalSharedSlotData>& Slot = Mgr->Slots.FindOrAdd(Key);
+	if (!Slot.IsValid())
+	{
+		Slot = MakeShared<GMP::FLocalSharedSlotData>();
+		Slot->Key = Key;
+		Slot->Prop = Prop;
+		Mgr->RefreshSlot(*Slot);
+	}
+	else if (!ensureMsgf(Slot->Prop->SameType(Prop), TEXT("LocalShared slot %s already resolved as %s"), *Key.ToString(), *Slot->Prop->GetCPPType()))
+	{
+		return nullptr;
+	}
+
+	if (!NotifyKey.IsNone())
+		Slot->NotifyKey = NotifyKey;
+	OutStorage = Mgr;
+	return Slot;
+}
+
+bool ULocalSharedStorage::SetSlotImpl(UObject* Storage, GMP::FLocalSharedSlotData& Slot, ELocalSharedOverrideMode Mode, const void* Data)
+{
+	auto Mgr = static_cast<ULocalSharedStorageInternal*>(Storage);
+	if (Slot.Addr)
+	{
+		if (Mode == ELocalSharedOverrideMode::Skip)
+			return false;
+
+		// in place for anything but objects, whose map entry is the one the gc sees
+		if (!CastField<FObjectProperty>(Slot.Prop))
+		{
+			Slot.Prop->CopyCompleteValue(Slot.Addr, Data);
+			Mgr->OnValueSet(Slot);
+			return true;
+		}
+	}
+
+	if (!Mgr->SetValue(Slot.Key, Mode, Slot.Prop, Data))
+		return false;
+	Mgr->RefreshSlot(Slot);
+	Mgr->OnValueSet(Slot);
+	return true;
+}
+
 ULocalSharedStorageInternal* ULocalSharedStorage::GetInternal(const UObject* InCtx)
 {
 	ULocalSharedStorageInternal* Mgr = nullptr;
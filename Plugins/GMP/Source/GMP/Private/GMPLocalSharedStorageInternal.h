@@ -20,6 +20,12 @@ public:
 
 protected:
 	friend class ULocalSharedStorage;
+	bool SetValue(FName Key, ELocalSharedOverrideMode Mode, const FProperty* Prop, const void* Data);
+	bool RemoveValue(FName Key);
+	void* FindValue(FName Key, const FProperty* Prop);
+	void RefreshSlot(GMP::FLocalSharedSlotData& Slot);
+	void OnValueSet(GMP::FLocalSharedSlotData& Slot);
+
 	// auto gc
 	UPROPERTY(Transient)
 	TMap<FName, FInstancedStruct> StructMap;
@@ -34,4 +40,7 @@ protected:
 
 	// msgs
 	TMap<FName, FGMPPropHeapHolderArray> MessageHolders;
+
+	// typed slot handles, see ULocalSharedStorage::FindOrAddSlot
+	TMap<FName, TSharedPtr<GMP::FLocalSharedSlotData>> Slots;
 };
@@ -16,8 +16,10 @@
 #include "GMPTypeTraits.h"
 #include "Misc/CommandLine.h"
 #include "Misc/DelayedAutoRegister.h"
+#include "Misc/ScopeRWLock.h"
 #include "Modules/ModuleInterface.h"
 #include "UObject/CoreRedirects.h"
+#include "UObject/ObjectKey.h"
 
 #include <algorithm>
 
@@ -225,6 +227,105 @@ namespace WorldLocals
 			ensure(false);
 		}
 	}
+
+	namespace WorldIndex
+	{
+		// game thread only, like the storages indexed by it
+		static TMap<FObjectKey, int32> Indices;
+		// worlds already cleaned up, they only get the shared retired slot until they go away or init again
+		static TSet<FObjectKey> Retired;
+		static TArray<int32> FreeIndices;
+		static TArray<void (*)(int32)> Cleanups;
+		static int32 NextIndex = RetiredWorldIndex + 1;
+		static const UWorld* LastWorld = nullptr;
+		static int32 LastIndex = 0;
+
+		static void ReleaseIndex(int32 Idx)
+		{
+			for (auto Func : Cleanups)
+				Func(Idx);
+			FreeIndices.Add(Idx);
+			LastWorld = nullptr;
+			LastIndex = 0;
+		}
+
+		static void Release(UWorld* InWorld)
+		{
+			const FObjectKey Key(InWorld);
+			Retired.Add(Key);
+
+			int32 Idx = 0;
+			if (Indices.RemoveAndCopyValue(Key, Idx))
+				ReleaseIndex(Idx);
+		}
+
+		static void PruneCollected()
+		{
+			for (auto It = Indices.CreateIterator(); It; ++It)
+			{
+				if (!It->Key.ResolveObjectPtr())
+				{
+					const int32 Idx = It->Value;
+					It.RemoveCurrent();
+					ReleaseIndex(Idx);
+				}
+			}
+			for (auto It = Retired.CreateIterator(); It; ++It)
+			{
+				if (!It->ResolveObjectPtr())
+					It.RemoveCurrent();
+			}
+
+			// the retired slot only lives until the next collection
+			for (auto Func : Cleanups)
+				Func(RetiredWorldIndex);
+			LastWorld = nullptr;
+			LastIndex = 0;
+		}
+
+		static void BindDelegates()
+		{
+			FWorldDelegates::OnWorldCleanup.AddLambda([](UWorld* InWorld, bool, bool) { Release(InWorld); });
+			FWorldDelegates::OnWorldBeginTearDown.AddStatic(&Release);
+			FWorldDelegates::OnPostWorldInitialization.AddLambda([](UWorld* InWorld, const UWorld::InitializationValues) { Retired.Remove(FObjectKey(InWorld)); });
+			FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&PruneCollected);
+		}
+	}  // namespace WorldIndex
+
+	int32 GetWorldIndex(const UWorld* InWorld, bool bAdd)
+	{
+		using namespace WorldIndex;
+		if (!InWorld)
+			return 0;
+		if (InWorld == LastWorld)
+			return LastIndex;
+
+		const FObjectKey Key(InWorld);
+		if (auto Find = Indices.Find(Key))
+		{
+			LastWorld = InWorld;
+			LastIndex = *Find;
+			return LastIndex;
+		}
+		if (Retired.Contains(Key))
+			return RetiredWorldIndex;
+		if (!bAdd)
+			return INDEX_NONE;
+
+		if (TrueOnFirstCall([] {}))
+			BindDelegates();
+
+		const int32 Idx = FreeIndices.Num() ? FreeIndices.Pop(EAllowShrinking::No) : NextIndex++;
+		Indices.Add(Key, Idx);
+		LastWorld = InWorld;
+		LastIndex = Idx;
+		return Idx;
+	}
+
+	void AddWorldIndexCleanup(void (*InFunc)(int32 WorldIndex))
+	{
+		WorldIndex::Cleanups.AddUnique(InFunc);
+	}
 }  // namespace WorldLocals
 
 int32 LastCountEnsureForRepeatListen = 1;
@@ -245,6 +346,67 @@ static TMap<FName, TArray<FName>> NativeParentsInfo;
 static TSet<FName> UnSupportedName;
 static TMap<FName, TArray<FName>> ParentsInfo;
 
+namespace TypeRegistry
+{
+	// Dense ids for the type names FNameSuccession compares. Each id caches the ids of its ancestors (itself included)
+	// and the enum ids it was matched against as bitsets, so a repeated IsDerivedFrom/MatchEnums check costs two id
+	// lookups and a bit test instead of parent array scans and enum name parsing. Any thread may query, the registry
+	// is guarded by Lock; the parent maps the bits are built from stay game thread state as before.
+	struct FTypeInfo
+	{
+		uint32 Generation = 0;  // of the ancestor bits, 0 while unresolved
+		uint32 EnumGeneration = 0;
+		TBitArray<> Ancestors;
+		TBitArray<> MatchedEnums;
+	};
+	static FRWLock Lock;
+	static TMap<FName, int32> Ids;
+	static TArray<FTypeInfo> Infos;
+
+	// bumped whenever a parent map changes or classes are reinstanced/reloaded, drops every cached bitset
+	static std::atomic<uint32> Generation{1};
+	static void Invalidate() { Generation.fetch_add(1, std::memory_order_relaxed); }
+	static uint32 CurrentGeneration() { return Generation.load(std::memory_order_relaxed); }
+
+	static FDelayedAutoRegisterHelper DelayBindInvalidation(EDelayedRegisterRunPhase::StartOfEnginePreInit, [] {
+#if WITH_EDITOR && UE_5_00_OR_LATER
+		FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([](const auto&) { Invalidate(); });
+#endif
+#if UE_5_00_OR_LATER
+		FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason) { Invalidate(); });
+#endif
+	});
+
+	// Classes the editor renames on recompile or reinstancing. Every compile makes new ones, giving them ids would grow
+	// the registry without bound, so checks involving them run uncached.
+	static bool IsTransientTypeName(FName Name)
+	{
+		const FString Str = Name.ToString();
+		int32 Index = INDEX_NONE;
+		const FStringView Leaf = Str.FindLastChar(TEXT('.'), Index) ? FStringView(Str).RightChop(Index + 1) : FStringView(Str);
+		return Leaf.StartsWith(TEXT("REINST_")) || Leaf.StartsWith(TEXT("SKEL_")) || Leaf.StartsWith(TEXT("TRASHCLASS_"))
+			   || Leaf.StartsWith(TEXT("HOTRELOADED_")) || Leaf.StartsWith(TEXT("PLACEHOLDER-CLASS_"));
+	}
+
+	// requires the write lock
+	static int32 GetId(FName Name)
+	{
+		if (auto Find = Ids.Find(Name))
+			return *Find;
+		const int32 Id = Infos.AddDefaulted();
+		Ids.Add(Name, Id);
+		return Id;
+	}
+
+	static bool TestBit(const TBitArray<>& Bits, int32 Index) { return Index < Bits.Num() && Bits[Index]; }
+	static void SetBit(TBitArray<>& Bits, int32 Index)
+	{
+		while (Bits.Num() <= Index)
+			Bits.Add(false);
+		Bits[Index] = true;
+	}
+}  // namespace TypeRegistry
+
 static const TArray<FName>* GetClassInfos(FName InClassName)
 {
 	if (UnSupportedName.Contains(InClassName))
@@ -256,6 +418,8 @@ static const TArray<FName>* GetClassInfos(FName InClassName)
 	if (auto Cls = Reflection::DynamicClass(InClassName.ToString()))
 	{
 		auto TypeName = Cls->IsNative() ? Cls->GetFName() : FName(*FSoftClassPath(Cls).ToString());
+		if (!ParentsInfo.Contains(TypeName))
+			TypeRegistry::Invalidate();
 		auto& Arr = ParentsInfo.Emplace(TypeName);
 		do
 		{
@@ -271,6 +435,9 @@ static const TArray<FName>* GetClassInfos(FName InClassName)
 FName FNameSuccession::GetClassName(UClass* InClass)
 {
 	auto TypeName = InClass->IsNative() ? InClass->GetFName() : FName(*FSoftClassPath(InClass).ToString());
+	// a rebuilt chain only differs after reparenting, which reinstances and invalidates anyway
+	if (!ParentsInfo.Contains(TypeName))
+		TypeRegistry::Invalidate();
 	auto& Set = ParentsInfo.Emplace(TypeName);
 	do
 	{
@@ -286,6 +453,7 @@ FName FNameSuccession::GetNativeClassName(UClass* InClass)
 	auto TypeName = InClass->GetFName();
 	if (!NativeParentsInfo.Contains(TypeName))
 	{
+		TypeRegistry::Invalidate();
 		auto& Set = NativeParentsInfo.Emplace(TypeName);
 		do
 		{
@@ -301,6 +469,7 @@ FName FNameSuccession::GetNativeClassPtrName(UClass* InClass)
 	auto TypeName = InClass->GetFName();
 	if (!NativeParentsInfo.Contains(TypeName))
 	{
+		TypeRegistry::Invalidate();
 		auto& Set = NativeParentsInfo.Emplace(TypeName);
 		do
 		{
@@ -316,23 +485,102 @@ namespace Reflection
 	extern bool MatchEnum(uint32 Bytes, FName TypeName);
 }  // namespace Reflection
 
+void FNameSuccession::InvalidateTypeCache()
+{
+	TypeRegistry::Invalidate();
+}
+
+int32 FNameSuccession::GetTypeId(FName Type)
+{
+	using namespace TypeRegistry;
+	{
+		FReadScopeLock ReadLock(Lock);
+		if (auto Find = Ids.Find(Type))
+			return *Find;
+	}
+	if (IsTransientTypeName(Type))
+		return INDEX_NONE;
+	FWriteScopeLock WriteLock(Lock);
+	return GetId(Type);
+}
+
 bool FNameSuccession::MatchEnums(FName IntType, FName EnumType)
 {
-	auto Bytes = Reflection::IsInteger(IntType);
-	return !!Bytes && Reflection::MatchEnum(Bytes, EnumType);
+	using namespace TypeRegistry;
+	const uint32 Bytes = Reflection::IsInteger(IntType);
+	if (!Bytes)
+		return false;
+
+	const uint32 CurGeneration = CurrentGeneration();
+	{
+		FReadScopeLock ReadLock(Lock);
+		const int32* IntId = Ids.Find(IntType);
+		const int32* EnumId = Ids.Find(EnumType);
+		if (IntId && EnumId && Infos[*IntId].EnumGeneration == CurGeneration && TestBit(Infos[*IntId].MatchedEnums, *EnumId))
+			return true;
+	}
+
+	// only matches are kept, an enum that fails now may still load later
+	if (!Reflection::MatchEnum(Bytes, EnumType))
+		return false;
+
+	FWriteScopeLock WriteLock(Lock);
+	// ids are taken before the info is referenced, GetId may grow Infos
+	const int32 EnumId = GetId(EnumType);
+	FTypeInfo& Info = Infos[GetId(IntType)];
+	if (Info.EnumGeneration != CurGeneration)
+	{
+		Info.MatchedEnums.Empty();
+		Info.EnumGeneration = CurGeneration;
+	}
+	SetBit(Info.MatchedEnums, EnumId);
+	return true;
 }
 
 bool FNameSuccession::IsDerivedFrom(FName Type, FName ParentType)
 {
-	auto FindNative = NativeParentsInfo.Find(Type);
-	if (FindNative && FindNative->Contains(ParentType))
-		return true;
+	using namespace TypeRegistry;
+	const uint32 CurGeneration = CurrentGeneration();
+	{
+		FReadScopeLock ReadLock(Lock);
+		const int32* TypeId = Ids.Find(Type);
+		if (TypeId && Infos[*TypeId].Generation == CurGeneration)
+		{
+			// every ancestor got an id when the bits were built, a name without one is none of them
+			const int32* ParentId = Ids.Find(ParentType);
+			return ParentId && TestBit(Infos[*TypeId].Ancestors, *ParentId);
+		}
+	}
 
-	if (auto Find = GetClassInfos(Type))
+	TArray<FName, TInlineAllocator<16>> Ancestors;
+	auto FindNative = NativeParentsInfo.Find(Type);
+	if (FindNative)
+		Ancestors.Append(*FindNative);
+	auto Find = GetClassInfos(Type);
+	if (Find)
+		Ancestors.Append(*Find);
+	const bool bDerived = Ancestors.Contains(ParentType);
+	// a name without any parent info stays unresolved, its class may show up later
+	if (!FindNative && !Find)
+		return bDerived;
+	if (IsTransientTypeName(Type))
+		return bDerived;
+
+	FWriteScopeLock WriteLock(Lock);
+	// ids are taken before the info is referenced, GetId may grow Infos
+	TArray<int32, TInlineAllocator<16>> AncestorIds;
+	for (FName Name : Ancestors)
 	{
-		return Find->Contains(ParentType);
+		// a registered class never derives from a transient one, leave them out of the registry
+		if (!IsTransientTypeName(Name))
+			AncestorIds.Add(GetId(Name));
 	}
-	return false;
+	FTypeInfo& Info = Infos[GetId(Type)];
+	Info.Ancestors.Empty();
+	for (int32 Id : AncestorIds)
+		SetBit(Info.Ancestors, Id);
+	Info.Generation = CurGeneration;
+	return bDerived;
 }
 
 bool FNameSuccession::IsTypeCompatible(FName lhs, FName rhs)
@@ -0,0 +1,476 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "GMP/GMPProcessBridge.h"
+
+#include "GMP/GMPUtils.h"
+#include "GMPCore.h"
+#include "GMPProcessBridgeRing.h"
+#include "GMPProcessLock.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/Paths.h"
+#include "Serialization/LargeMemoryReader.h"
+#include "XConsoleManager.h"
+
+namespace GMP
+{
+struct FGMPProcessBridge::FPeer
+{
+	uint32 Pid = 0;
+	TUniquePtr<Bridge::FRing> Ring;
+};
+
+static TArray<uint8> MakeKeyPayload(const FName& Key)
+{
+	TArray<uint8> Buffer;
+	FMemoryWriter Writer(Buffer);
+	FString KeyStr = Key.ToString();
+	Writer << KeyStr;
+	return Buffer;
+}
+
+FGMPProcessBridge& FGMPProcessBridge::Get()
+{
+	static FGMPProcessBridge Bridge;
+	static auto RegisterOnce = [] {
+		OnGMPModuleLifetime({}, FSimpleDelegate::CreateLambda([] { Bridge.Stop(); }));
+		return true;
+	}();
+	(void)RegisterOnce;
+	return Bridge;
+}
+
+FGMPProcessBridge::FGMPProcessBridge()
+{
+	SelfPid = FPlatformProcess::GetCurrentProcessId();
+}
+
+FGMPProcessBridge::~FGMPProcessBridge()
+{
+	Stop();
+}
+
+FString FGMPProcessBridge::GetLockFilePath(const FString& InChannel)
+{
+	return FPaths::ProjectSavedDir() / TEXT("GMPLocks") / FString::Printf(TEXT("Bridge_%s.lock"), *InChannel);
+}
+
+bool FGMPProcessBridge::Start(const FString& InChannel, EGMPBridgeRole InRole, uint32 InboxSize, bool bAutoPump)
+{
+	if (IsRunning())
+	{
+		GMP_WARNING(TEXT("GMPBridge already running on channel %s"), *Channel);
+		return Channel == InChannel;
+	}
+	if (!ensure(!InChannel.IsEmpty()))
+		return false;
+
+	const FString LockPath = GetLockFilePath(InChannel);
+	uint32 OwnerPid = 0;
+	const bool bHostAlive = !FGMPProcessLock::CanLock(LockPath, OwnerPid) && OwnerPid != SelfPid;
+	if ((InRole == EGMPBridgeRole::Host && bHostAlive) || (InRole == EGMPBridgeRole::Sidecar && !bHostAlive))
+	{
+		GMP_WARNING(TEXT("GMPBridge cannot start as %s on channel %s"), InRole == EGMPBridgeRole::Host ? TEXT("host") : TEXT("sidecar"), *InChannel);
+		return false;
+	}
+
+	const uint32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max(InboxSize, 64u * 1024u));
+	Inbox = Bridge::FRing::Create(Bridge::GetRegionName(InChannel, SelfPid), Capacity);
+	if (!Inbox)
+	{
+		GMP_ERROR(TEXT("GMPBridge failed to map inbox for channel %s"), *InChannel);
+		return false;
+	}
+
+	Channel = InChannel;
+	bIsHost = !bHostAlive;
+	if (bIsHost)
+	{
+		HostLock = MakeUnique<FGMPProcessLock>();
+		if (!HostLock->TryLock(LockPath))
+		{
+			HostLock.Reset();
+			Inbox.Reset();
+			return false;
+		}
+		HostPid = SelfPid;
+	}
+	else
+	{
+		HostPid = OwnerPid;
+		FPeer* Host = ConnectPeer(HostPid);
+		if (!Host || !SendTo(*Host, Bridge::Hello, {}))
+		{
+			GMP_ERROR(TEXT("GMPBridge failed to reach host %u on channel %s"), HostPid, *InChannel);
+			Peers.Reset();
+			Inbox.Reset();
+			return false;
+		}
+		for (auto& Key : LocalSubscriptions)
+			SendTo(*Host, Bridge::Subscribe, MakeKeyPayload(Key));
+	}
+
+	auto Holder = NewObject<UGMPPlaceHolder>();
+	Holder->AddToRoot();
+	Listener = Holder;
+
+	if (bAutoPump)
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FGMPProcessBridge::Tick));
+
+	GMP_LOG(TEXT("GMPBridge started as %s on channel %s, pid %u"), bIsHost ? TEXT("host") : TEXT("sidecar"), *Channel, SelfPid);
+	return true;
+}
+
+void FGMPProcessBridge::Stop()
+{
+	if (!IsRunning())
+		return;
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	for (auto& Pair : Peers)
+		SendTo(*Pair.Value, Bridge::Bye, {});
+
+	TArray<uint32> PeerPids;
+	Peers.GetKeys(PeerPids);
+	for (auto Pid : PeerPids)
+		DisconnectPeer(Pid);
+
+	if (UObject* Holder = Listener.Get())
+		Holder->RemoveFromRoot();
+	Listener.Reset();
+	Routes.Reset();
+	HostLock.Reset();
+	Inbox.Reset();
+	HostPid = 0;
+	bIsHost = false;
+	GMP_LOG(TEXT("GMPBridge stopped on channel %s"), *Channel);
+}
+
+bool FGMPProcessBridge::Subscribe(const FName& Key)
+{
+	if (Key.IsNone())
+		return false;
+	bool bAlreadyInSet = false;
+	LocalSubscriptions.Add(Key, &bAlreadyInSet);
+	if (bAlreadyInSet || !IsRunning())
+		return true;
+
+	const TArray<uint8> Payload = MakeKeyPayload(Key);
+	bool bSucc = true;
+	for (auto& Pair : Peers)
+		bSucc &= SendTo(*Pair.Value, Bridge::Subscribe, Payload);
+	return bSucc;
+}
+
+void FGMPProcessBridge::Unsubscribe(const FName& Key)
+{
+	if (!LocalSubscriptions.Remove(Key) || !IsRunning())
+		return;
+
+	const TArray<uint8> Payload = MakeKeyPayload(Key);
+	for (auto& Pair : Peers)
+		SendTo(*Pair.Value, Bridge::Unsubscribe, Payload);
+}
+
+void FGMPProcessBridge::WriteMessageHeader(FArchive& Ar, const FName& Key, TArrayView<const FName> Types)
+{
+	FString KeyStr = Key.ToString();
+	Ar << KeyStr;
+	int32 Num = Types.Num();
+	Ar << Num;
+	for (const FName& Type : Types)
+	{
+		FString TypeStr = Type.ToString();
+		Ar << TypeStr;
+	}
+}
+
+bool FGMPProcessBridge::PublishPayload(const FName& Key, const TArray<uint8>& Payload)
+{
+	if (!IsRunning())
+		return false;
+
+	bool bSucc = true;
+	for (auto& Pair : Peers)
+	{
+		if (bIsHost)
+		{
+			auto Route = Routes.Find(Key);
+			if (!Route || !Route->Subscribers.Contains(Pair.Key))
+				continue;
+		}
+		bSucc &= SendTo(*Pair.Value, Bridge::Publish, Payload);
+	}
+	return bSucc;
+}
+
+bool FGMPProcessBridge::PublishRaw(const FName& Key, const FGMPTypedAddr* Addrs, int32 Num, const FName* Types)
+{
+	const TArray<FName>* Registered = Types ? nullptr : FMessageBody::GetMessageTypes(nullptr, Key);
+	if (!Types && Registered && Registered->Num() == Num)
+		Types = Registered->GetData();
+	if (!Types && Num > 0)
+	{
+		GMP_WARNING(TEXT("GMPBridge cannot publish %s without parameter types"), *Key.ToString());
+		return false;
+	}
+
+	TArray<uint8> Buffer;
+	FMemoryWriter Writer(Buffer);
+	FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+	WriteMessageHeader(Ar, Key, MakeArrayView(Types, Num));
+	for (int32 Idx = 0; Idx < Num; ++Idx)
+	{
+		FProperty* Prop = nullptr;
+		if (!GMPReflection::PropertyFromString(Types[Idx].ToString(), Prop) || !Prop)
+		{
+			GMP_WARNING(TEXT("GMPBridge cannot resolve type %s of %s"), *Types[Idx].ToString(), *Key.ToString());
+			return false;
+		}
+		Prop->SerializeItem(FStructuredArchiveFromArchive(Ar).GetSlot(), Addrs[Idx].ToAddr());
+	}
+	return PublishPayload(Key, Buffer);
+}
+
+int32 FGMPProcessBridge::Pump(int32 MaxRecords)
+{
+	if (!IsRunning())
+		return 0;
+	return Inbox->Consume(MaxRecords, [this](uint16 Kind, uint32 SenderPid, const uint8* Data, int32 Size) { HandleRecord(Kind, SenderPid, Data, Size); });
+}
+
+bool FGMPProcessBridge::Tick(float DeltaTime)
+{
+	Pump();
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now >= NextLivenessCheck)
+	{
+		NextLivenessCheck = Now + 2.0;
+		TArray<uint32> Dead;
+		for (auto& Pair : Peers)
+		{
+			if (!Bridge::IsProcessAlive(Pair.Key))
+				Dead.Add(Pair.Key);
+		}
+		for (auto Pid : Dead)
+		{
+			GMP_WARNING(TEXT("GMPBridge peer %u on channel %s is gone"), Pid, *Channel);
+			DisconnectPeer(Pid);
+		}
+	}
+	return true;
+}
+
+FGMPProcessBridge::FPeer* FGMPProcessBridge::ConnectPeer(uint32 Pid)
+{
+	if (auto Found = Peers.Find(Pid))
+		return Found->Get();
+
+	auto Ring = Bridge::FRing::Open(Bridge::GetRegionName(Channel, Pid));
+	if (!Ring)
+		return nullptr;
+
+	auto Peer = MakeUnique<FPeer>();
+	Peer->Pid = Pid;
+	Peer->Ring = MoveTemp(Ring);
+	return Peers.Add(Pid, MoveTemp(Peer)).Get();
+}
+
+void FGMPProcessBridge::DisconnectPeer(uint32 Pid)
+{
+	TArray<FName> Keys;
+	Routes.GetKeys(Keys);
+	for (auto& Key : Keys)
+		RemoveSubscriber(Key, Pid);
+	Peers.Remove(Pid);
+}
+
+bool FGMPProcessBridge::SendTo(FPeer& Peer, uint16 Kind, const TArray<uint8>& Payload)
+{
+	if (Peer.Ring->Write(Kind, SelfPid, Payload.GetData(), Payload.Num()))
+		return true;
+	GMP_WARNING(TEXT("GMPBridge inbox of %u is full, dropped %d bytes"), Peer.Pid, Payload.Num());
+	return false;
+}
+
+void FGMPProcessBridge::HandleRecord(uint16 Kind, uint32 SenderPid, const uint8* Data, int32 Size)
+{
+	auto ReadKey = [&] {
+		FString KeyStr;
+		FLargeMemoryReader Reader(Data, Size);
+		Reader << KeyStr;
+		return FName(*KeyStr);
+	};
+
+	switch (Kind)
+	{
+		case Bridge::Hello:
+			if (FPeer* Peer = ConnectPeer(SenderPid))
+			{
+				GMP_LOG(TEXT("GMPBridge peer %u joined channel %s"), SenderPid, *Channel);
+				for (auto& Key : LocalSubscriptions)
+					SendTo(*Peer, Bridge::Subscribe, MakeKeyPayload(Key));
+			}
+			break;
+		case Bridge::Bye:
+			GMP_LOG(TEXT("GMPBridge peer %u left channel %s"), SenderPid, *Channel);
+			DisconnectPeer(SenderPid);
+			break;
+		case Bridge::Subscribe:
+			AddSubscriber(ReadKey(), SenderPid);
+			break;
+		case Bridge::Unsubscribe:
+			RemoveSubscriber(ReadKey(), SenderPid);
+			break;
+		case Bridge::Publish:
+			DispatchPublish(SenderPid, Data, Size);
+			break;
+		default:
+			GMP_WARNING(TEXT("GMPBridge unknown record kind %d from %u"), Kind, SenderPid);
+			break;
+	}
+}
+
+void FGMPProcessBridge::DispatchPublish(uint32 SenderPid, const uint8* Data, int32 Size)
+{
+	FLargeMemoryReader Reader(Data, Size);
+	FObjectAndNameAsStringProxyArchive Ar(Reader, false);
+
+	FString KeyStr;
+	int32 Num = 0;
+	Ar << KeyStr << Num;
+	if (Ar.IsError() || Num < 0 || Num > 64)
+	{
+		GMP_WARNING(TEXT("GMPBridge malformed publish from %u"), SenderPid);
+		return;
+	}
+	const FName Key(*KeyStr);
+
+	FGMPPropStackHolderArray PropHolders;
+	PropHolders.Reserve(Num);
+	TArray<FProperty*, TInlineAllocator<GMP_MSG_HOLDER_DEFAULT_INLINE_SIZE>> Props;
+	for (int32 Idx = 0; Idx < Num; ++Idx)
+	{
+		FString TypeStr;
+		Ar << TypeStr;
+		FProperty* Prop = nullptr;
+		if (Ar.IsError() || !GMPReflection::PropertyFromString(TypeStr, Prop) || !Prop)
+		{
+			GMP_WARNING(TEXT("GMPBridge cannot resolve type %s of %s"), *TypeStr, *KeyStr);
+			return;
+		}
+		Props.Add(Prop);
+	}
+	for (FProperty* Prop : Props)
+	{
+		auto& Holder = PropHolders.Emplace_GetRef(Prop, FMemory_Alloca_Aligned(Prop->ElementSize, Prop->GetMinAlignment()));
+		Prop->SerializeItem(FStructuredArchiveFromArchive(Ar).GetSlot(), Holder.GetAddr());
+	}
+	if (Ar.IsError())
+	{
+		GMP_WARNING(TEXT("GMPBridge truncated publish %s from %u"), *KeyStr, SenderPid);
+		return;
+	}
+
+	TGuardValue<uint32> Guard(DispatchingPid, SenderPid);
+	FMessageHub::FTagTypeSetter SetMsgTagType(TEXT("Bridge"));
+	FTypedAddresses Params;
+	Params.Reserve(Num);
+	FMessageUtils::ScriptNotifyMessage(Key, FGMPTypedAddr::FromHolderArray(Params, PropHolders));
+}
+
+void FGMPProcessBridge::AddSubscriber(const FName& Key, uint32 Pid)
+{
+	if (Key.IsNone() || !Listener.IsValid())
+		return;
+
+	FRoute& Route = Routes.FindOrAdd(Key);
+	Route.Subscribers.AddUnique(Pid);
+	if (Route.ListenKey)
+		return;
+
+#if GMP_WITH_DIRECT_SIGNAL
+	Route.ListenKey = FMessageUtils::ScriptListenMessageRaw(FSigSource::NullSigSrc, Key, Listener.Get(), [this](const FGMPTypedAddr* Addrs, const FGMPExtra* Extra) {
+		ForwardLocal(Extra->Key, Addrs, Extra->Size, Extra->TypeNames);
+	});
+#else
+	Route.ListenKey = FMessageUtils::ScriptListenMessage(FSigSource::NullSigSrc, Key, Listener.Get(), [this](FMessageBody& Body) {
+		const auto Addrs = Body.GetParams();
+		const TArray<FName>* Types = Body.GetMessageTypes(nullptr);
+		ForwardLocal(Body.MessageKey(), Addrs.GetData(), Addrs.Num(), Types && Types->Num() == Addrs.Num() ? Types->GetData() : nullptr);
+	});
+#endif
+}
+
+void FGMPProcessBridge::RemoveSubscriber(const FName& Key, uint32 Pid)
+{
+	FRoute* Route = Routes.Find(Key);
+	if (!Route)
+		return;
+
+	Route->Subscribers.Remove(Pid);
+	if (Route->Subscribers.Num() == 0)
+	{
+		if (Route->ListenKey)
+			FMessageUtils::ScriptUnbindMessage(Key, Route->ListenKey);
+		Routes.Remove(Key);
+	}
+}
+
+void FGMPProcessBridge::ForwardLocal(const FName& Key, const FGMPTypedAddr* Addrs, int32 Num, const FName* Types)
+{
+	auto Route = Routes.Find(Key);
+	if (!Route)
+		return;
+
+	// only relay to subscribers other than the process the message came from
+	bool bHasTarget = false;
+	for (auto Pid : Route->Subscribers)
+		bHasTarget |= (Pid != DispatchingPid);
+	if (!bHasTarget)
+		return;
+
+	if (!Types)
+	{
+		auto Registered = FMessageBody::GetMessageTypes(nullptr, Key);
+		if (!Registered || Registered->Num() != Num)
+		{
+			GMP_CWARNING(true, TEXT("GMPBridge cannot forward unregistered key %s"), *Key.ToString());
+			return;
+		}
+		Types = Registered->GetData();
+	}
+
+	TArray<uint8> Buffer;
+	FMemoryWriter Writer(Buffer);
+	FObjectAndNameAsStringProxyArchive Ar(Writer, false);
+	WriteMessageHeader(Ar, Key, MakeArrayView(Types, Num));
+	for (int32 Idx = 0; Idx < Num; ++Idx)
+	{
+		FProperty* Prop = nullptr;
+		if (!GMPReflection::PropertyFromString(Types[Idx].ToString(), Prop) || !Prop)
+			return;
+		Prop->SerializeItem(FStructuredArchiveFromArchive(Ar).GetSlot(), Addrs[Idx].ToAddr());
+	}
+
+	for (auto Pid : Route->Subscribers)
+	{
+		if (Pid == DispatchingPid)
+			continue;
+		if (auto Peer = Peers.Find(Pid))
+			SendTo(**Peer, Bridge::Publish, Buffer);
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+FXConsoleCommandLambda XVar_GMPBridgeStart(TEXT("gmp.bridge.start"), [](FString InChannel, UWorld* InWorld) { FGMPProcessBridge::Get().Start(InChannel); });
+FXConsoleCommandLambda XVar_GMPBridgeStop(TEXT("gmp.bridge.stop"), [](UWorld* InWorld) { FGMPProcessBridge::Get().Stop(); });
+FXConsoleCommandLambda XVar_GMPBridgeSubscribe(TEXT("gmp.bridge.subscribe"), [](FName InKey, UWorld* InWorld) { FGMPProcessBridge::Get().Subscribe(InKey); });
+#endif
+}  // namespace GMP
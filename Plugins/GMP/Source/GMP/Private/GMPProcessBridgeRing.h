@@ -0,0 +1,264 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "GMPCore.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformProcess.h"
+
+namespace GMP
+{
+namespace Bridge
+{
+	enum ERecordKind : uint16
+	{
+		Padding,
+		Hello,
+		Bye,
+		Subscribe,
+		Unsubscribe,
+		Publish,
+	};
+
+	static const uint32 RingMagic = 0x47425247;  // 'GRBG'
+	static const uint32 RingVersion = 2;
+	static const int64 RecordAlignment = 16;
+	// how long the consumer waits on a record that never commits before checking whether its producer is gone
+	static const double StallTimeout = 2.0;
+
+	struct alignas(64) FRingHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+		uint32 Capacity;
+		uint32 OwnerPid;
+		alignas(64) volatile int64 WriteHead;
+		alignas(64) volatile int64 ReadHead;
+	};
+
+	// every 16 byte slot starts with a State word, only the one at a record boundary is meaningful
+	//  Free      : tag 1, the ring position this slot may next be reserved at (so a stale position never matches)
+	//  Reserved  : tag 2, record size and producer pid, written by the same CAS that claims the slot
+	//  Committed : tag 3, same as Reserved once Kind/PayloadSize/payload are in place
+	// a producer dying at any point leaves either Free (nothing happened) or Reserved (exact size known)
+	struct FRecordHeader
+	{
+		volatile int64 State;
+		uint16 Kind;
+		uint16 Reserved;
+		uint32 PayloadSize;
+	};
+	static_assert(sizeof(FRecordHeader) == RecordAlignment, "record header must keep records aligned");
+
+	namespace RecordState
+	{
+		static const uint64 TagShift = 62;
+		static const uint64 TagFree = 1;
+		static const uint64 TagReserved = 2;
+		static const uint64 TagCommitted = 3;
+		static const uint64 PaddingBit = 1ull << 61;
+		static const uint64 SizeMask = (1ull << 29) - 1;
+
+		inline int64 Free(int64 Pos) { return int64((TagFree << TagShift) | (uint64(Pos) >> 4)); }
+		inline int64 Reserved(int64 Size, uint32 Pid) { return int64((TagReserved << TagShift) | ((uint64(Size >> 4) & SizeMask) << 32) | Pid); }
+		inline int64 Committed(int64 Reserved) { return int64(uint64(Reserved) | (1ull << TagShift)); }
+		inline int64 Padding(int64 Size) { return int64((TagCommitted << TagShift) | PaddingBit | ((uint64(Size >> 4) & SizeMask) << 32)); }
+
+		inline uint64 GetTag(int64 State) { return uint64(State) >> TagShift; }
+		inline int64 GetSize(int64 State) { return int64((uint64(State) >> 32) & SizeMask) << 4; }
+		inline uint32 GetPid(int64 State) { return uint32(uint64(State)); }
+		inline bool IsPadding(int64 State) { return !!(uint64(State) & PaddingBit); }
+	}  // namespace RecordState
+
+	inline FString GetRegionName(const FString& Channel, uint32 Pid) { return FString::Printf(TEXT("GMPBridge_%s_%u"), *Channel, Pid); }
+
+	inline bool IsProcessAlive(uint32 Pid) { return FPlatformProcess::IsApplicationRunning(Pid); }
+
+	struct FRing
+	{
+		FPlatformMemory::FSharedMemoryRegion* Region = nullptr;
+		FRingHeader* Header = nullptr;
+		uint8* Data = nullptr;
+		int64 Capacity = 0;
+		int64 StallTail = -1;
+		double StallSince = 0.0;
+		double StallTimeout = Bridge::StallTimeout;
+
+		~FRing()
+		{
+			if (Region)
+				FPlatformMemory::UnmapNamedSharedMemoryRegion(Region);
+		}
+
+		static TUniquePtr<FRing> Create(const FString& Name, uint32 InCapacity)
+		{
+			auto Region = FPlatformMemory::MapNamedSharedMemoryRegion(Name, true, FPlatformMemory::ESharedMemoryAccess::Read | FPlatformMemory::ESharedMemoryAccess::Write, sizeof(FRingHeader) + InCapacity);
+			if (!Region)
+				return nullptr;
+
+			auto Ring = MakeUnique<FRing>();
+			Ring->Bind(Region);
+			FMemory::Memzero(Region->GetAddress(), Region->GetSize());
+			Ring->Header->Magic = RingMagic;
+			Ring->Header->Version = RingVersion;
+			Ring->Header->Capacity = InCapacity;
+			Ring->Header->OwnerPid = FPlatformProcess::GetCurrentProcessId();
+			Ring->Capacity = InCapacity;
+			for (int64 Pos = 0; Pos < Ring->Capacity; Pos += RecordAlignment)
+				Ring->RecordAt(Pos)->State = RecordState::Free(Pos);
+			FPlatformMisc::MemoryBarrier();
+			return Ring;
+		}
+
+		static TUniquePtr<FRing> Open(const FString& Name)
+		{
+			const uint32 Access = FPlatformMemory::ESharedMemoryAccess::Read | FPlatformMemory::ESharedMemoryAccess::Write;
+			auto Probe = FPlatformMemory::MapNamedSharedMemoryRegion(Name, false, Access, sizeof(FRingHeader));
+			if (!Probe)
+				return nullptr;
+
+			const auto* ProbeHeader = static_cast<const FRingHeader*>(Probe->GetAddress());
+			const bool bValid = ProbeHeader->Magic == RingMagic && ProbeHeader->Version == RingVersion && FMath::IsPowerOfTwo(ProbeHeader->Capacity);
+			const uint32 InCapacity = ProbeHeader->Capacity;
+			FPlatformMemory::UnmapNamedSharedMemoryRegion(Probe);
+			if (!bValid)
+				return nullptr;
+
+			auto Region = FPlatformMemory::MapNamedSharedMemoryRegion(Name, false, Access, sizeof(FRingHeader) + InCapacity);
+			if (!Region)
+				return nullptr;
+			auto Ring = MakeUnique<FRing>();
+			Ring->Bind(Region);
+			Ring->Capacity = InCapacity;
+			return Ring;
+		}
+
+		void Bind(FPlatformMemory::FSharedMemoryRegion* InRegion)
+		{
+			Region = InRegion;
+			Header = static_cast<FRingHeader*>(Region->GetAddress());
+			Data = reinterpret_cast<uint8*>(Header + 1);
+		}
+
+		FRecordHeader* RecordAt(int64 Pos) const { return reinterpret_cast<FRecordHeader*>(Data + (Pos & (Capacity - 1))); }
+
+		// any number of producers, claims the slot at WriteHead with its size before moving WriteHead
+		// a producer seeing a claimed slot at WriteHead moves WriteHead past it on behalf of its owner
+		bool Reserve(uint32 SenderPid, int32 Size, int64& OutPos)
+		{
+			const int64 Need = Align(int64(sizeof(FRecordHeader)) + Size, RecordAlignment);
+			if (Need > Capacity / 2)
+				return false;
+
+			for (;;)
+			{
+				const int64 Head = FPlatformAtomics::AtomicRead(&Header->WriteHead);
+				const int64 Offset = Head & (Capacity - 1);
+				const int64 Len = (Offset + Need > Capacity) ? (Capacity - Offset) : Need;
+				if (Head + Len - FPlatformAtomics::AtomicRead(&Header->ReadHead) > Capacity)
+					return false;
+
+				// ReadHead is published after the slot is freed, so past the check above the slot holds Free(Head) or a claim of this lap
+				auto* Record = RecordAt(Head);
+				const int64 Expected = RecordState::Free(Head);
+				const int64 Claim = (Len == Need) ? RecordState::Reserved(Need, SenderPid) : RecordState::Padding(Len);
+				const int64 State = FPlatformAtomics::InterlockedCompareExchange(&Record->State, Claim, Expected);
+				if (State != Expected)
+				{
+					if (RecordState::GetTag(State) != RecordState::TagFree)
+						FPlatformAtomics::InterlockedCompareExchange(&Header->WriteHead, Head + RecordState::GetSize(State), Head);
+					continue;
+				}
+
+				FPlatformAtomics::InterlockedCompareExchange(&Header->WriteHead, Head + Len, Head);
+				if (Len == Need)
+				{
+					OutPos = Head;
+					return true;
+				}
+			}
+		}
+
+		void Commit(int64 Pos, uint16 Kind, const uint8* Payload, int32 Size)
+		{
+			auto* Record = RecordAt(Pos);
+			Record->Kind = Kind;
+			Record->PayloadSize = Size;
+			if (Size > 0)
+				FMemory::Memcpy(Record + 1, Payload, Size);
+			FPlatformAtomics::InterlockedExchange(&Record->State, RecordState::Committed(Record->State));
+		}
+
+		bool Write(uint16 Kind, uint32 SenderPid, const uint8* Payload, int32 Size)
+		{
+			int64 Pos = 0;
+			if (!Reserve(SenderPid, Size, Pos))
+				return false;
+			Commit(Pos, Kind, Payload, Size);
+			return true;
+		}
+
+		void FreeRange(int64 From, int64 To)
+		{
+			for (; From < To; From += RecordAlignment)
+				FPlatformAtomics::InterlockedExchange(&RecordAt(From)->State, RecordState::Free(From + Capacity));
+		}
+
+		bool IsStalled(int64 Tail, double Timeout)
+		{
+			const double Now = FPlatformTime::Seconds();
+			if (StallTail != Tail)
+			{
+				StallTail = Tail;
+				StallSince = Now;
+				return false;
+			}
+			return Now - StallSince >= Timeout;
+		}
+
+		// single consumer
+		template<typename F>
+		int32 Consume(int32 MaxRecords, const F& Handler)
+		{
+			int32 Handled = 0;
+			int64 Tail = Header->ReadHead;
+			while (MaxRecords <= 0 || Handled < MaxRecords)
+			{
+				auto* Record = RecordAt(Tail);
+				const int64 State = FPlatformAtomics::AtomicRead(&Record->State);
+				const uint64 Tag = RecordState::GetTag(State);
+				if (Tag == RecordState::TagFree)
+				{
+					ensureMsgf(State == RecordState::Free(Tail), TEXT("GMPBridge corrupted free slot at %lld"), Tail);
+					break;
+				}
+
+				const int64 Size = RecordState::GetSize(State);
+				if (!ensureMsgf(Tag != 0 && Size > 0 && Size <= Capacity, TEXT("GMPBridge corrupted record state %llx"), State))
+					break;
+
+				if (Tag == RecordState::TagReserved)
+				{
+					// a producer that died after reserving never commits, its record would block the ring forever
+					// the claim carries the exact size, so only that record is skipped once the owner is gone
+					const uint32 Pid = RecordState::GetPid(State);
+					if (!IsStalled(Tail, StallTimeout) || IsProcessAlive(Pid))
+						break;
+					GMP_WARNING(TEXT("GMPBridge reclaimed %lld bytes reserved by dead producer %u"), Size, Pid);
+				}
+				else if (!RecordState::IsPadding(State))
+				{
+					Handler(Record->Kind, RecordState::GetPid(State), reinterpret_cast<const uint8*>(Record + 1), int32(Record->PayloadSize));
+					++Handled;
+				}
+				FreeRange(Tail, Tail + Size);
+				Tail += Size;
+				FPlatformAtomics::InterlockedExchange(&Header->ReadHead, Tail);
+			}
+			return Handled;
+		}
+	};
+}  // namespace Bridge
+}  // namespace GMP
@@ -908,37 +908,26 @@ namespace Proto
 		}
 	};
 
-	static FProperty* FindPropertyByField(const UScriptStruct* Struct, FFieldDefPtr FieldDef)
+	static FProperty* FindPropertyByField(const UScriptStruct* Struct, const GMP::Serializer::Traits::FStructVisitPlan& Plan, FFieldDefPtr FieldDef)
 	{
-#if 0
-		const bool bIsNative = Struct->IsNative();
-		if (bIsNative)
-		{
-			auto FieldName = FieldDef.Name().ToFName();
-			for (TFieldIterator<FProperty> It(Struct); It; ++It)
-			{
-				if (It->GetFName() == FieldName)
-				{
-					return *It;
-				}
-			}
-			GMP_ERROR(TEXT("FindPropertyByField(%s, %s) Failed"), *GetNameSafe(Struct), *FieldDef.Name().ToFString());
-		}
-		else
-#endif
-		{
-			auto FieldName = FieldDef.Name().ToFString();
-			for (TFieldIterator<FProperty> It(Struct); It; ++It)
-			{
-				auto PropName = It->GetName();
-				if (!PropName.StartsWith(FieldName) || PropName.Len() <= FieldName.Len() || PropName[FieldName.Len()] != TEXT('_'))
-					continue;
+		// authored names (user defined struct postfix stripped) are resolved once per struct layout
+		if (auto Visit = Plan.FindByAuthoredName(FieldDef.Name().ToFName(FNAME_Find)))
+			return Visit->Property;
 
-				if (GMP::Serializer::StripUserDefinedStructName(PropName) && PropName == FieldName)
-					return *It;
-			}
-			GMP_ERROR(TEXT("FindPropertyByField(%s, %s) Failed"), *GetNameSafe(Struct), *FieldName);
+		// the plan skips Transient/EditorOnly/SkipSerialization fields, a proto schema may still carry them
+		auto FieldName = FieldDef.Name().ToFString();
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			auto PropName = It->GetName();
+			if (PropName == FieldName)
+				return *It;
+			if (!PropName.StartsWith(FieldName) || PropName.Len() <= FieldName.Len() || PropName[FieldName.Len()] != TEXT('_'))
+				continue;
+
+			if (GMP::Serializer::StripUserDefinedStructName(PropName) && PropName == FieldName)
+				return *It;
 		}
+		GMP_ERROR(TEXT("FindPropertyByField(%s, %s) Failed"), *GetNameSafe(Struct), *FieldName);
 		return nullptr;
 	}
 
@@ -948,9 +937,10 @@ namespace Proto
 		auto MsgRef = MsgPtr ? MsgPtr : upb_Message_New(MsgDef.MiniTable(), Arena);
 
 		int32 Ret = 0;
+		const auto Plan = GMP::Serializer::Traits::GetStructVisitPlan(StructProp->Struct);
 		for (FFieldDefPtr FieldDef : MsgDef.Fields())
 		{
-			auto Prop = FindPropertyByField(StructProp->Struct, FieldDef);
+			auto Prop = FindPropertyByField(StructProp->Struct, *Plan, FieldDef);
 			// Should ensure struct always has the same field as proto?
 			if (ensureAlways(Prop))
 			{
@@ -969,9 +959,10 @@ namespace Proto
 	int32 DecodeProtoImpl(const FMessageDefPtr& MsgDef, const upb_Message* MsgRef, FStructProperty* StructProp, void* StructAddr)
 	{
 		int32 Ret = 0;
+		const auto Plan = GMP::Serializer::Traits::GetStructVisitPlan(StructProp->Struct);
 		for (FFieldDefPtr FieldDef : MsgDef.Fields())
 		{
-			auto Prop = FindPropertyByField(StructProp->Struct, FieldDef);
+			auto Prop = FindPropertyByField(StructProp->Struct, *Plan, FieldDef);
 			// Should ensure struct always has the same field as proto?
 			if (Prop)
 			{
@@ -1948,6 +1939,41 @@ bool UGMPProtoUtils::AsValueImpl(const FGMPValueOneOf& In, FProperty* Prop, void
 	return bRet;
 }
 
+bool UGMPProtoUtils::AsValueImpl(const FGMPValueOneOf& In, FProperty* Prop, void* Out, const FGMPValuePath& Path)
+{
+	bool bRet = false;
+	do
+	{
+#if WITH_GMPVALUE_ONEOF && defined(GMP_WITH_UPB)
+		using namespace GMP::Proto;
+		auto OneOfPtr = &FriendGMPValueOneOf(In);
+
+		if (!OneOfPtr->IsValid() || !ensure(OneOfPtr->Flags == 0))
+			break;
+
+		auto Ptr = StaticCastSharedPtr<FPBValueHolder>(OneOfPtr->Value);
+		// walk the field defs in place, each level reads straight out of its parent message
+		FProtoReader Reader = Ptr->Reader;
+		bool bFound = true;
+		for (int32 Idx = 0; Idx < Path.Num(); ++Idx)
+		{
+			auto& Segment = Path.GetSegment(Idx);
+			if (Segment.Key.IsNone())
+				continue;
+			auto SubFieldDef = Reader.IsMessage() ? Reader.FieldDef.MessageSubdef().FindFieldByName((const char*)Segment.Utf8.GetData(), Segment.Utf8.Num()) : FFieldDefPtr();
+			if (!SubFieldDef)
+			{
+				bFound = false;
+				break;
+			}
+			Reader = FProtoReader(SubFieldDef, Reader.GetSubMessage());
+		}
+		bRet = bFound && DecodeProtoImpl(Reader, Prop, Out) > 0;
+#endif
+	} while (false);
+	return bRet;
+}
+
 int32 UGMPProtoUtils::IterateKeyValueImpl(const FGMPValueOneOf& In, int32 Idx, FString& OutKey, FGMPValueOneOf& OutValue)
 {
 	int32 RetIdx = INDEX_NONE;
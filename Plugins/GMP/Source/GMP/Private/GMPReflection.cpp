@@ -12,6 +12,7 @@
 #include "GMPUnion.h"
 #include "GMPHub.h"
 #include "Internationalization/Regex.h"
+#include "Misc/DelayedAutoRegister.h"
 #include "Misc/PackageName.h"
 #include "Misc/ScopeExit.h"
 #include "UObject/Interface.h"
@@ -1412,7 +1413,68 @@ namespace Reflection
 	}
 
 	//////////////////////////////////////////////////////////////////////////
-	FName GetPropertyName(const FProperty* InProperty, bool bExactType)
+	namespace PropertyNameCache
+	{
+		// Each thread keeps its own map, no locking on lookups. Bumping the epoch drops every thread's entries on their next
+		// lookup, which happens whenever fields may have been destroyed or replaced (GC, reinstancing, hot reload).
+		static TAtomic<uint32> Epoch{0};
+
+		struct FEntry
+		{
+			FName Name;
+			const FFieldClass* Class = nullptr;
+		};
+		struct FCache
+		{
+			uint32 Epoch = ~0u;
+			TMap<TPair<const FProperty*, uint32>, FEntry> Entries;
+		};
+
+		static void Invalidate() { ++Epoch; }
+
+		static FDelayedAutoRegisterHelper DelayBindInvalidation(EDelayedRegisterRunPhase::StartOfEnginePreInit, [] {
+			FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&Invalidate);
+#if WITH_EDITOR && UE_5_00_OR_LATER
+			FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda([](const auto&) { Invalidate(); });
+#endif
+#if UE_5_00_OR_LATER
+			FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason) { Invalidate(); });
+#endif
+		});
+
+		static FCache& GetCache()
+		{
+			static thread_local FCache Cache;
+			const uint32 CurEpoch = Epoch.Load(EMemoryOrder::Relaxed);
+			if (Cache.Epoch != CurEpoch)
+			{
+				Cache.Entries.Reset();
+				Cache.Epoch = CurEpoch;
+			}
+			return Cache;
+		}
+
+		template<typename F>
+		FORCEINLINE FName FindOrAdd(const FProperty* InProperty, uint32 Variant, const F& Compute)
+		{
+			if (!InProperty)
+				return Compute();
+
+			const TPair<const FProperty*, uint32> Key{InProperty, Variant};
+			if (auto Find = GetCache().Entries.Find(Key))
+			{
+				// a freed field whose address got reused before the next invalidation
+				if (Find->Class == InProperty->GetClass())
+					return Find->Name;
+			}
+			// computing recurses into container inner properties and may grow the map, no reference is held across it
+			FName Result = Compute();
+			GetCache().Entries.Add(Key, FEntry{Result, InProperty->GetClass()});
+			return Result;
+		}
+	}  // namespace PropertyNameCache
+
+	static FName GetPropertyNameImpl(const FProperty* InProperty, bool bExactType)
 	{
 		using namespace Class2Name;
 
@@ -1550,7 +1612,28 @@ namespace Reflection
 		return Result;
 	}
 
-	FName GetPropertyName(const FProperty* InProperty, EGMPPropertyClass PropertyType, EGMPPropertyClass ValueEnum, EGMPPropertyClass KeyPropType)
+	FName GetPropertyName(const FProperty* InProperty, bool bExactType)
+	{
+		return PropertyNameCache::FindOrAdd(InProperty, bExactType ? 1u : 0u, [&] { return GetPropertyNameImpl(InProperty, bExactType); });
+	}
+
+	void WarmupPropertyNames(const UStruct* InStruct)
+	{
+		if (!InStruct)
+			return;
+		for (TFieldIterator<FProperty> It(InStruct); It; ++It)
+		{
+			GetPropertyName(*It, true);
+			GetPropertyName(*It, false);
+		}
+	}
+
+	uint32 GetFieldEpoch()
+	{
+		return PropertyNameCache::Epoch.Load(EMemoryOrder::Relaxed);
+	}
+
+	static FName GetPropertyNameImpl(const FProperty* InProperty, EGMPPropertyClass PropertyType, EGMPPropertyClass ValueEnum, EGMPPropertyClass KeyPropType)
 	{
 		using namespace Class2Name;
 
@@ -1661,6 +1744,13 @@ namespace Reflection
 		return Result;
 	}
 
+	FName GetPropertyName(const FProperty* InProperty, EGMPPropertyClass PropertyType, EGMPPropertyClass ValueEnum, EGMPPropertyClass KeyPropType)
+	{
+		// the high bit keeps these apart from the bExactType variants
+		const uint32 Variant = (1u << 31) | uint32(uint8(PropertyType)) | (uint32(uint8(ValueEnum)) << 8) | (uint32(uint8(KeyPropType)) << 16);
+		return PropertyNameCache::FindOrAdd(InProperty, Variant, [&] { return GetPropertyNameImpl(InProperty, PropertyType, ValueEnum, KeyPropType); });
+	}
+
 	static TAtomic<EExactTestMask> GlobalExactTestBits{EExactTestMask::TestExactly};
 	FExactTestMaskScope::FExactTestMaskScope(EExactTestMask Lv)
 	{
@@ -2098,13 +2188,49 @@ namespace Class2Name
 
 }  // namespace Class2Name
 
+namespace MatchTypeCache
+{
+	// (template, type name, target class) triples MatchMessageType already accepted and (type name, bytes) pairs
+	// FGMPTypedAddr::MatchEnum did, so checked GetParam calls skip the name parsing and reflection lookup. Per thread,
+	// dropped together with PropertyNameCache on its epoch.
+	using FKey = TTuple<const TCHAR*, FName, const UClass*>;
+	using FEnumKey = TPair<FName, uint32>;
+	struct FCache
+	{
+		uint32 Epoch = ~0u;
+		TSet<FKey> Matched;
+		TSet<FEnumKey> MatchedEnums;
+	};
+
+	static FCache& GetCache()
+	{
+		static thread_local FCache Cache;
+		const uint32 CurEpoch = Reflection::PropertyNameCache::Epoch.Load(EMemoryOrder::Relaxed);
+		if (Cache.Epoch != CurEpoch)
+		{
+			Cache.Matched.Reset();
+			Cache.MatchedEnums.Reset();
+			Cache.Epoch = CurEpoch;
+		}
+		return Cache;
+	}
+	static TSet<FKey>& GetMatched() { return GetCache().Matched; }
+}  // namespace MatchTypeCache
+
 template<uint32 N>
 static bool MatchMessageType(const TCHAR (&TMPL)[N], FName TypeName, UClass* TargetClass)
 {
+	const MatchTypeCache::FKey Key{TMPL, TypeName, TargetClass};
+	if (MatchTypeCache::GetMatched().Contains(Key))
+		return true;
+
 	UClass* FromClass = nullptr;
 	if (!Reflection::FMyMatcher(TMPL, TypeName.ToString(), FromClass) || !FromClass)
 		FromClass = Reflection::DynamicClass(TypeName.ToString());
-	return ensureMsgf(FromClass && TargetClass && FromClass->IsChildOf(TargetClass), TEXT("Message Type Mismatch From:%s To:%s"), *GetNameSafe(FromClass), *GetNameSafe(TargetClass));
+	const bool bMatch = ensureMsgf(FromClass && TargetClass && FromClass->IsChildOf(TargetClass), TEXT("Message Type Mismatch From:%s To:%s"), *GetNameSafe(FromClass), *GetNameSafe(TargetClass));
+	if (bMatch)
+		MatchTypeCache::GetMatched().Add(Key);
+	return bMatch;
 }
 
 }  // namespace GMP
@@ -2113,7 +2239,13 @@ bool FGMPTypedAddr::MatchEnum(uint32 Bytes) const
 {
 	using namespace GMP;
 #if GMP_WITH_TYPENAME
-	return Reflection::MatchEnum(Bytes, TypeName);
+	const MatchTypeCache::FEnumKey Key{TypeName, Bytes};
+	if (MatchTypeCache::GetCache().MatchedEnums.Contains(Key))
+		return true;
+	if (!Reflection::MatchEnum(Bytes, TypeName))
+		return false;
+	MatchTypeCache::GetCache().MatchedEnums.Add(Key);
+	return true;
 #else
 	return ensureMsgf(false, TEXT("please enable GMP_WITH_TYPENAME"));
 #endif
@@ -375,19 +375,49 @@ bool UGMPRpcProxy::CallLocalMessage(const UObject* InObject, const FString& Mess
 	FName MessageName(*MessageStr, FNAME_Find);
 	const TArray<FProperty*>* Find = MessageName.IsValid() ? UGMPRpcValidation::Find(this, MessageName) : nullptr;
 	if (!ensureWorldMsgf(InObject, Find, TEXT("rpc not registered for %s"), *MessageName.ToString()))
+	{
+		ResyncUnionNetShadow();
 		return false;
+	}
 
-	if (!ensureWorldMsgf(InObject, FMessageUtils::GetMessageHub()->IsAlive(MessageName), TEXT("no listener for %s"), *MessageStr))
-		return false;
+	// still decoded without listeners, union args have to advance the delta shadow in step with the sender
+	const bool bAlive = FMessageUtils::GetMessageHub()->IsAlive(MessageName);
+	ensureWorldMsgf(InObject, bAlive, TEXT("no listener for %s"), *MessageStr);
+	return LocalBroadcastMessage(MessageStr, *Find, InObject, Buffer, bAlive) && bAlive;
+}
 
-	return LocalBroadcastMessage(MessageStr, *Find, InObject, Buffer);
+void UGMPRpcProxy::ResyncUnionNetShadow()
+{
+	// no delta payloads without gmp.net.UnionDelta, a failed decode is not a shadow mismatch then
+	if (!GMP::IsUnionNetDeltaEnabled())
+		return;
+	GMP::ResetUnionNetReceiveShadow(UGMPBPLib::GetPackageMap(CastChecked<APlayerController>(GetOwner())));
+	if (GetNetMode() == NM_Client)
+		UnionShadow_Request();
+	else
+		UnionShadow_Notify();
+}
+
+bool UGMPRpcProxy::UnionShadow_Request_Validate()
+{
+	return true;
+}
+
+void UGMPRpcProxy::UnionShadow_Request_Implementation()
+{
+	GMP::ResetUnionNetShadow(UGMPBPLib::GetPackageMap(CastChecked<APlayerController>(GetOwner())));
+}
+
+void UGMPRpcProxy::UnionShadow_Notify_Implementation()
+{
+	GMP::ResetUnionNetShadow(UGMPBPLib::GetPackageMap(CastChecked<APlayerController>(GetOwner())));
 }
 
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable : 4750)  // warning C4750: function with _alloca() inlined into a loop
 #endif
-bool UGMPRpcProxy::LocalBroadcastMessage(const FString& MessageStr, const TArray<FProperty*>& Props, const UObject* Sender, const TArray<uint8>& Buffer)
+bool UGMPRpcProxy::LocalBroadcastMessage(const FString& MessageStr, const TArray<FProperty*>& Props, const UObject* Sender, const TArray<uint8>& Buffer, bool bDispatch)
 {
 	using namespace GMP;
 	bool bSucc = true;
@@ -440,7 +470,11 @@ bool UGMPRpcProxy::LocalBroadcastMessage(const FString& MessageStr, const TArray
 		}
 	}
 
-	if (bSucc)
+	if (!bSucc)
+	{
+		ResyncUnionNetShadow();
+	}
+	else if (bDispatch)
 	{
 		FMessageUtils::GetMessageHub()->ScriptNotifyMessage(MessageStr, Params, Sender ? Sender : GetWorld());
 	}
@@ -111,7 +111,14 @@ protected:
 	//////////////////////////////////////////////////////////////////////////
 protected:
 	bool CallLocalMessage(const UObject* InObject, const FString& MessageStr, const TArray<uint8>& Buffer);
-	bool LocalBroadcastMessage(const FString& MessageStr, const TArray<FProperty*>& Props, const UObject* InObject, const TArray<uint8>& Buffer);
+	bool LocalBroadcastMessage(const FString& MessageStr, const TArray<FProperty*>& Props, const UObject* InObject, const TArray<uint8>& Buffer, bool bDispatch = true);
+
+	// a payload that could not be decoded leaves the union delta shadows of both ends apart, both start over
+	void ResyncUnionNetShadow();
+	UFUNCTION(Server, Reliable, WithValidation)
+	void UnionShadow_Request();
+	UFUNCTION(Client, Reliable)
+	void UnionShadow_Notify();
 
 	UFUNCTION(Server, Reliable, WithValidation)
 	void Message_Request(const UObject* InObject, const FString& MessageStr, const TArray<uint8>& Buffer);
@@ -2,7 +2,20 @@
 
 #include "GMPSerializer.h"
 
+#include "GMPReflection.h"
+#include "Misc/ScopeRWLock.h"
 #include "UObject/NameTypes.h"
+#include "UObject/ObjectKey.h"
+
+#if UE_5_05_OR_LATER
+#include "StructUtils/UserDefinedStruct.h"
+#else
+#include "Engine/UserDefinedStruct.h"
+#endif
+
+#if WITH_EDITOR
+#include "Kismet2/StructureEditorUtils.h"
+#endif
 
 namespace GMP
 {
@@ -78,5 +91,135 @@ namespace Serializer
 			return FName(NameView.Len(), NameView.GetData());
 	}
 
+	namespace Traits
+	{
+		EPropKind GetPropKind(const FProperty* Property)
+		{
+			// a field class id is its own cast flag, so subclasses of these (FLargeWorldCoordinatesRealProperty...) stay Other
+			switch (Property->GetClass()->GetId())
+			{
+				case CASTCLASS_FStructProperty:
+					return EPropKind::Struct;
+				case CASTCLASS_FArrayProperty:
+					return EPropKind::Array;
+				case CASTCLASS_FSetProperty:
+					return EPropKind::Set;
+				case CASTCLASS_FMapProperty:
+					return EPropKind::Map;
+				case CASTCLASS_FStrProperty:
+					return EPropKind::Str;
+				case CASTCLASS_FNameProperty:
+					return EPropKind::Name;
+				case CASTCLASS_FTextProperty:
+					return EPropKind::Text;
+				case CASTCLASS_FBoolProperty:
+					return EPropKind::Bool;
+				case CASTCLASS_FEnumProperty:
+					return EPropKind::Enum;
+				case CASTCLASS_FInt8Property:
+					return EPropKind::Int8;
+				case CASTCLASS_FInt16Property:
+					return EPropKind::Int16;
+				case CASTCLASS_FIntProperty:
+					return EPropKind::Int;
+				case CASTCLASS_FInt64Property:
+					return EPropKind::Int64;
+				case CASTCLASS_FByteProperty:
+					return EPropKind::Byte;
+				case CASTCLASS_FUInt16Property:
+					return EPropKind::UInt16;
+				case CASTCLASS_FUInt32Property:
+					return EPropKind::UInt32;
+				case CASTCLASS_FUInt64Property:
+					return EPropKind::UInt64;
+				case CASTCLASS_FFloatProperty:
+					return EPropKind::Float;
+				case CASTCLASS_FDoubleProperty:
+					return EPropKind::Double;
+				case CASTCLASS_FSoftObjectProperty:
+				case CASTCLASS_FSoftClassProperty:
+					return EPropKind::SoftObject;
+				default:
+					return EPropKind::Other;
+			}
+		}
+
+		namespace Details
+		{
+			static FRWLock PlanLock;
+			// FObjectKey carries the serial number, a struct reallocated at the same address never hits a stale plan
+			static TMap<FObjectKey, FStructVisitPlanRef> Plans;
+			// the map is emptied whenever the field epoch moves, plans of collected structs do not pile up
+			static uint32 PlansEpoch = ~0u;
+
+			static bool IsPlanUpToDate(const FStructVisitPlan& Plan, const UStruct* Struct)
+			{
+				// recompiling a user defined struct recreates its properties in place
+				return Plan.LayoutHead == Struct->ChildProperties && Plan.LayoutSize == Struct->GetPropertiesSize();
+			}
+
+#if WITH_EDITOR
+			// the layout check above can miss a recompile that reuses the freed property memory, drop the plan explicitly
+			class FUserStructPlanInvalidator : public FStructureEditorUtils::INotifyOnStructChanged
+			{
+			public:
+				virtual void PreChange(const UUserDefinedStruct* Changed, FStructureEditorUtils::EStructureEditorChangeInfo ChangedType) override {}
+				virtual void PostChange(const UUserDefinedStruct* Changed, FStructureEditorUtils::EStructureEditorChangeInfo ChangedType) override { InvalidateStructVisitPlan(Changed); }
+			};
+#endif
+		}  // namespace Details
+
+		FStructVisitPlanRef GetStructVisitPlan(const UStruct* Struct)
+		{
+			const FObjectKey StructKey(Struct);
+			const uint32 CurEpoch = Reflection::GetFieldEpoch();
+			{
+				FReadScopeLock ReadLock(Details::PlanLock);
+				auto Find = Details::PlansEpoch == CurEpoch ? Details::Plans.Find(StructKey) : nullptr;
+				if (Find && Details::IsPlanUpToDate(**Find, Struct))
+					return *Find;
+			}
+
+			TSharedRef<FStructVisitPlan, ESPMode::ThreadSafe> Plan = MakeShared<FStructVisitPlan, ESPMode::ThreadSafe>();
+			Plan->LayoutHead = Struct->ChildProperties;
+			Plan->LayoutSize = Struct->GetPropertiesSize();
+			Plan->bUserDefined = Struct->IsA(UUserDefinedStruct::StaticClass());
+			for (TFieldIterator<FProperty> It(Struct); It; ++It)
+			{
+				if (It->HasAnyPropertyFlags(CPF_Deprecated | CPF_Transient | CPF_SkipSerialization | CPF_EditorOnly))
+					continue;
+
+				FPropVisit& Visit = Plan->Props.AddDefaulted_GetRef();
+				Visit.Property = *It;
+				Visit.Kind = GetPropKind(*It);
+				Visit.AuthoredString = It->GetName();
+				if (Plan->bUserDefined)
+					StripUserDefinedStructName(Visit.AuthoredString);
+				Visit.AuthoredName = FName(*Visit.AuthoredString);
+				Plan->AuthoredIndex.Add(Visit.AuthoredName, Plan->Props.Num() - 1);
+			}
+
+#if WITH_EDITOR
+			if (Plan->bUserDefined && GIsEditor)
+			{
+				static Details::FUserStructPlanInvalidator UserStructPlanInvalidator;
+			}
+#endif
+			FWriteScopeLock WriteLock(Details::PlanLock);
+			if (Details::PlansEpoch != CurEpoch)
+			{
+				Details::Plans.Empty();
+				Details::PlansEpoch = CurEpoch;
+			}
+			return Details::Plans.Emplace(StructKey, Plan);
+		}
+
+		void InvalidateStructVisitPlan(const UStruct* Struct)
+		{
+			FWriteScopeLock WriteLock(Details::PlanLock);
+			Details::Plans.Remove(FObjectKey(Struct));
+		}
+	}  // namespace Traits
+
 }  // namespace Serializer
 }  // namespace GMP
@@ -1,7 +1,9 @@
 //  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
 
 #include "GMPSignalsImpl.h"
+#include "GMPMemoryStats.h"
 #include "GMPMessageKeySlot.h"
+#include "GMPTrace.h"
 
 #include "Containers/LockFreeList.h"
 #include "Engine/GameInstance.h"
@@ -331,7 +333,10 @@ struct FSignalUtils
 				bool bShouldErase = !Elem->IsInvokable();
 				if (!bShouldErase)
 				{
-					PerElem(Elem);
+					{
+						GMP_TRACE_LISTENER_SCOPE(StoreRef.MessageKey, Elem);
+						PerElem(Elem);
+					}
 					bShouldErase = !Elem->TestTimes();
 				}
 				if (bShouldErase)
@@ -393,7 +398,10 @@ struct FSignalUtils
 			bool bShouldErase = !Elem->IsInvokable();
 			if (!bShouldErase)
 			{
-				PerElem(Elem);
+				{
+					GMP_TRACE_LISTENER_SCOPE(StoreRef.MessageKey, Elem);
+					PerElem(Elem);
+				}
 				bShouldErase = !Elem->TestTimes();
 			}
 			if (bShouldErase)
@@ -595,6 +603,7 @@ public:
 
 	static void AddMessageMapping(FSigSource InSigSrc, FSignalStore* InPtr)
 	{
+		GMP_LLM_SCOPE(GMP_Signals);
 		if (InSigSrc.IsValid())
 			TryGet()->MessageMappings.FindOrAdd(InSigSrc).Add(InPtr->AsShared());
 	}
@@ -651,6 +660,45 @@ void DestroyGMPSourceAndHandlerDeleter()
 	FGMPSourceAndHandlerDeleter::OnPreExit();
 }
 
+void GMPForEachSignalStore(TFunctionRef<void(FSignalStore&)> Func)
+{
+	GMP_VERIFY_GAME_THREAD();
+	TArray<FSignalStore*, TInlineAllocator<32>> Stores;
+	if (auto Deleter = FGMPSourceAndHandlerDeleter::TryGet(false))
+		Stores = Deleter->SignalStores;
+	for (FSignalStore* Store : Stores)
+		Func(*Store);
+}
+
+SIZE_T GMPGetSourceMappingSize(int32* OutNumMappings, int32* OutNumExtKeys)
+{
+	SIZE_T Bytes = 0;
+	int32 NumMappings = 0;
+	int32 NumExtKeys = 0;
+	if (auto Deleter = FGMPSourceAndHandlerDeleter::TryGet(false))
+	{
+		Bytes += Deleter->MessageMappings.GetAllocatedSize();
+		for (auto& Pair : Deleter->MessageMappings)
+		{
+			Bytes += Pair.Value.GetAllocatedSize();
+			NumMappings += Pair.Value.Num();
+		}
+		Bytes += Deleter->SigSourceKeys.GetAllocatedSize();
+		Bytes += Deleter->SigSourceExtStorages.GetAllocatedSize();
+		for (auto& Pair : Deleter->SigSourceExtStorages)
+		{
+			// std::set node: value plus three links and the color word
+			Bytes += Pair.Value.size() * (sizeof(FSigSourceExtKey) + 4 * sizeof(void*));
+			NumExtKeys += static_cast<int32>(Pair.Value.size());
+		}
+	}
+	if (OutNumMappings)
+		*OutNumMappings = NumMappings;
+	if (OutNumExtKeys)
+		*OutNumExtKeys = NumExtKeys;
+	return Bytes;
+}
+
 FDelayedAutoRegisterHelper DelayCreateDeleter(EDelayedRegisterRunPhase::PreObjectSystemReady, [] { CreateGMPSourceAndHandlerDeleter(); });
 
 #if GMP_DEBUG_SIGNAL
@@ -818,6 +866,7 @@ FSigSource FSigSource::SigSourceKey(FSigSource InSig, FName InName, bool bCreate
 {
 	GMP_VERIFY_GAME_THREAD();
 	GMP_CHECK_SLOW(InSig);
+	GMP_LLM_SCOPE(GMP_Signals);
 	FSigSource Ret;
 	do
 	{
@@ -857,6 +906,7 @@ FSigSource::AddrType FSigSource::ObjectToAddr(const UObject* InObj)
 
 TSharedRef<FSignalStore, FSignalBase::SPMode> FSignalImpl::MakeSignals(FName MessageKey)
 {
+	GMP_LLM_SCOPE(GMP_Signals);
 	auto SignalImpl = MakeShared<FSignalStore, FSignalBase::SPMode>();
 	SignalImpl->MessageKey = MessageKey;
 	return SignalImpl;
@@ -1032,15 +1082,33 @@ FSignalImpl::FOnFireResults FSignalImpl::OnFireWithSigSource(FSigSource InSigSrc
 template GMP_API FSignalImpl::FOnFireResults FSignalImpl::OnFireWithSigSource<true>(FSigSource InSigSrc, const TGMPFunctionRef<void(FSigElm*)>& Invoker, uint32 ExpectSig) const;
 template GMP_API FSignalImpl::FOnFireResults FSignalImpl::OnFireWithSigSource<false>(FSigSource InSigSrc, const TGMPFunctionRef<void(FSigElm*)>& Invoker, uint32 ExpectSig) const;
 
+int32 GGMPShareBPSendArgs = 0;
+static thread_local int32 MessageSendDepth = 0;
+bool FMessageSendScope::IsTracking()
+{
+	return MessageSendDepth > 0;
+}
+void FMessageSendScope::Enter()
+{
+	++MessageSendDepth;
+}
+void FMessageSendScope::Leave()
+{
+	if (--MessageSendDepth == 0)
+		ResetBPSendArgs();
+}
+
 #if GMP_WITH_DIRECT_SIGNAL
 #if WITH_EDITOR
 TArray<FGMPKey, TInlineAllocator<16>> GMPFireWithSigSourceDirectRaw(FSignalStore* RawStore, FSigSource InSigSrc, const void* a0, const void* a1)
 {
+	FMessageSendScope SendScope;
 	return FSignalUtils::FireWithSigSourceRaw<false>(*RawStore, InSigSrc, a0, a1);
 }
 #else
 void GMPFireWithSigSourceDirectRaw(FSignalStore* RawStore, FSigSource InSigSrc, const void* a0, const void* a1)
 {
+	FMessageSendScope SendScope;
 	FSignalUtils::FireWithSigSourceRaw<false>(*RawStore, InSigSrc, a0, a1);
 }
 #endif
@@ -1139,6 +1207,55 @@ TArray<FGMPKey> FSignalStore::GetKeysByHandler(const UObject* InHandler) const
 	return Keys;
 }
 
+TArray<FGMPKey> FSignalStore::GetStaleKeys() const
+{
+	GMP_VERIFY_GAME_THREAD();
+	TArray<FGMPKey> Keys;
+	for (auto& Up : SigElmArray)
+	{
+		FSigElm* Elem = Up.Get();
+		if (Elem && Elem->GetHandler().IsStale(true))
+			Keys.Add(Elem->GetGMPKey());
+	}
+	return Keys;
+}
+
+int32 FSignalStore::PurgeStaleKeys()
+{
+	auto Keys = GetStaleKeys();
+	for (auto Key : Keys)
+		FSignalUtils::DisconnectHandlerByID<false>(this, Key);
+	return Keys.Num();
+}
+
+int32 FSignalStore::GetListenerNum() const
+{
+	int32 Num = 0;
+	for (auto& Up : SigElmArray)
+	{
+		if (Up)
+			++Num;
+	}
+	return Num;
+}
+
+SIZE_T FSignalStore::GetAllocatedSize(SIZE_T* OutCallableBytes) const
+{
+	SIZE_T Bytes = SigElmArray.GetAllocatedSize();
+	SIZE_T CallableBytes = 0;
+	for (auto& Up : SigElmArray)
+	{
+		if (FSigElm* Elem = Up.Get())
+		{
+			Bytes += sizeof(FSigElm);
+			CallableBytes += Elem->GetHeapAllocatedSize();
+		}
+	}
+	if (OutCallableBytes)
+		*OutCallableBytes = CallableBytes;
+	return Bytes + CallableBytes;
+}
+
 bool FSignalStore::IsAlive(const UObject* InHandler, FSigSource InSigSrc) const
 {
 	GMP_VERIFY_GAME_THREAD();
@@ -1163,6 +1280,7 @@ void FSignalStore::RemoveSigElmStorage(FGMPKey SigKey)
 
 FSigElm* FSignalStore::AddSigElmImpl(FGMPKey Key, const UObject* InListener, FSigSource InSigSrc, const TGMPFunctionRef<FSigElm*()>& Ctor)
 {
+	GMP_LLM_SCOPE(GMP_Signals);
 	FSigElm* SigElm = FindSigElm(Key);
 	if (!SigElm)
 	{
@@ -17,6 +17,15 @@
 #include "GMPBPFastCall.h"  // C++->BP zero-copy FastCall under test (T20-T23)
 #include "GMPRpcUtils.h"    // RPC path: compile-only smoke (needs real net to run; see GMPRpc_CompileSmoke)
 #include "GMPRpcProxy.h"    // UGMPRpcProxy full definition (needed for UObject* conversion in RecvRPC)
+#include "GMPMemoryStats.h"
+#include "GMPProcessBridge.h"
+#include "GMPProcessBridgeRing.h"
+#include "GMPTrace.h"
+#include "GMPJsonSerializer.h"
+#include "GMPLocalSharedStorage.h"
+#include "GMPLuaRewrite.h"
+#include "GMPBPLib.h"
+#include "GMPUnion.h"
 #include "UObject/Package.h"
 #include "UObject/UObjectGlobals.h"
 #include "Misc/AutomationTest.h"
@@ -34,6 +43,14 @@
 #include "GMPFlexBackend.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogGMPUnitTest, Log, All);
+namespace GMP
+{
+namespace Class2Prop
+{
+	UGMPPropertiesContainer* GMPGetMessagePropertiesHolder();
+}
+}  // namespace GMP
+
 namespace GMPUnitTest
 {
 using namespace GMP;
@@ -498,6 +515,43 @@ static bool Test_AutoInvalidationPurgesStaleListenerImmediately()
 }
 GMP_IMPLEMENT_AUTOMATION_TEST(Test_AutoInvalidationPurgesStaleListenerImmediately, "GMP.Core.AutoInvalidationPurgesStaleListenerImmediately")
 
+// ---- T6d: memory accounting + stale-listener detection without a fire ----------
+// A listener whose handler is collected lingers until its key fires again; the detector must see it and purge it.
+static bool Test_MemoryStatsStaleListener()
+{
+	GMP_TEST_BEGIN("T6d.memory stats report listeners and detect stale handlers");
+	UObject* Src = MakeProbe();
+	const auto Key = MSGKEY("GMP.UT.MemStale");
+	const FName KeyName = TEXT("GMP.UT.MemStale");
+
+	UObject* Listener = NewObject<UGMPTestProbe>(GetTransientPackage(), UGMPTestProbe::StaticClass(), NAME_None, RF_Transient);
+	Hub()->ListenObjectMessage(Key, Src, Listener, [](int32) {});
+
+	TArray<FGMPKeyMemory> Keys;
+	const FGMPMemorySummary Summary = MemoryStats::CollectKeyMemory(Keys);
+	auto Info = Keys.FindByPredicate([&](const FGMPKeyMemory& Elem) { return Elem.Key == KeyName; });
+	GMP_TEST_CHECK(Info && Info->Listeners == 1);
+	GMP_TEST_CHECK(Info && Info->StaleListeners == 0);
+	GMP_TEST_CHECK(Info && Info->StoreBytes > 0);
+	GMP_TEST_CHECK(Summary.GetTotalBytes() >= (Info ? Info->GetTotalBytes() : 0));
+
+	Listener = nullptr;
+	CollectGarbage(RF_NoFlags, true);
+
+	TArray<FGMPStaleListener> Stales;
+	MemoryStats::CollectStaleListeners(Stales);
+	GMP_TEST_CHECK(Stales.ContainsByPredicate([&](const FGMPStaleListener& Elem) { return Elem.Key == KeyName; }));
+
+	MemoryStats::PurgeStaleListeners();
+	Stales.Reset();
+	MemoryStats::CollectStaleListeners(Stales);
+	GMP_TEST_CHECK(!Stales.ContainsByPredicate([&](const FGMPStaleListener& Elem) { return Elem.Key == KeyName; }));
+
+	Src->RemoveFromRoot();
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_MemoryStatsStaleListener, "GMP.Core.MemoryStatsStaleListener")
+
 // ---- T7: per-object source isolation ----------------------------------------
 // Two distinct UObject sources on the same key: a send to A must reach only A's listener, not B's.
 static bool Test_SourceObjectIsolation()
@@ -1416,6 +1470,40 @@ static bool Test_TypedMixedQualifiers()
 	GMP_TEST_END();
 }
 GMP_IMPLEMENT_AUTOMATION_TEST(Test_TypedMixedQualifiers, "GMP.Typed.TypedMixedQualifiers")
+
+#if GMP_WITH_DYNAMIC_CALL_CHECK
+// ---- signature check memo: a sender's static type list is checked once per store until any signature registers ----
+static bool Test_SignatureCheckMemo()
+{
+	GMP_TEST_BEGIN("SignatureCheckMemo");
+	UObject* Src = MakeProbe();
+	auto Slot = MSGKEY_SLOT("GMP.UT.SigCheckMemo");
+	FSigHandle H;
+	int32 Got = 0;
+	ListenObjectMessageDirect(Slot, FSigSource(Src), &H, [&](int32 V) { Got += V; });
+	FSignalStore* Store = Slot.GetStore();
+
+	SendObjectMessageDirect(Slot, FSigSource(Src), int32(1));
+	SendObjectMessageDirect(Slot, FSigSource(Src), int32(2));
+	GMP_TEST_CHECK(Got == 3);
+	const FArrayTypeNames& Names = FMessageBody::MakeStaticNamesImpl<int32>();
+	GMP_TEST_CHECK(Store->SigCheckMemo.Num() == 1);
+	const uint32 Epoch = Store->SigCheckMemo.Num() ? Store->SigCheckMemo[0].Epoch : 0;
+	GMP_TEST_CHECK(Store->SigCheckMemo.Num() && Store->SigCheckMemo[0].SenderTypes == &Names);
+
+	// a signature registered on any other key invalidates the memo, the next send checks (and memoizes) again
+	static int32 Run = 0;
+	const FArrayTypeNames* OldTypes = nullptr;
+	GMP_TEST_CHECK(FMessageHub::IsSignatureCompatible(false, FName(*FString::Printf(TEXT("GMP.UT.SigCheckMemo.%d"), ++Run)), FMessageBody::MakeStaticNamesImpl<float>(), OldTypes));
+	SendObjectMessageDirect(Slot, FSigSource(Src), int32(3));
+	GMP_TEST_CHECK(Got == 6);
+	GMP_TEST_CHECK(Store->SigCheckMemo.Num() == 1 && Store->SigCheckMemo[0].Epoch != Epoch);
+
+	Src->RemoveFromRoot();
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_SignatureCheckMemo, "GMP.Typed.SignatureCheckMemo")
+#endif
 #if !GMP_WITH_STATIC_STORE  // modular-only: slot handle lazy ResolvePtr + duplicate OwnerSlot de-dup
 // ---- T20: lazy / on-demand slot resolution (slot used before EndOfEngineInit batch-bind) ----
 // Simulate an unbound slot (Ptr==null, i.e. direct API used before the startup batch bind, or an Editor modular
@@ -2285,6 +2373,819 @@ static bool Test_FastCallNonPodRefAndReturn()
 }
 GMP_IMPLEMENT_AUTOMATION_TEST(Test_FastCallNonPodRefAndReturn, "GMP.FastCall.NonPodRefAndReturn")
 
+// ---- T25: the lock-free eligibility cache computes each verdict once until it is reset ----
+static bool Test_FastCallEligibilityTable()
+{
+	GMP_TEST_BEGIN("T25.FastCall eligibility table");
+	UFunction* AddInts = UGMPTestProbe::StaticClass()->FindFunctionByName(TEXT("FastCallAddInts"));
+	UFunction* ScaleOut = UGMPTestProbe::StaticClass()->FindFunctionByName(TEXT("FastCallScaleOut"));
+	GMP_TEST_CHECK(AddInts && ScaleOut);
+	if (AddInts && ScaleOut)
+	{
+		// tables register themselves for the GC reset and must outlive it
+		static GMP::FastCall::FEligibilityTable Table;
+		Table.Reset();
+		int32 Computed = 0;
+		auto Yes = [&] { ++Computed; return true; };
+		auto No = [&] { ++Computed; return false; };
+		GMP_TEST_CHECK(Table.FindOrAdd(AddInts, Yes));
+		GMP_TEST_CHECK(Table.FindOrAdd(AddInts, No));  // cached verdict, not recomputed
+		GMP_TEST_CHECK(!Table.FindOrAdd(ScaleOut, No));
+		GMP_TEST_CHECK(!Table.FindOrAdd(ScaleOut, Yes));
+		GMP_TEST_CHECK(Computed == 2);
+		Table.Reset();
+		GMP_TEST_CHECK(!Table.FindOrAdd(AddInts, No));
+	}
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_FastCallEligibilityTable, "GMP.FastCall.EligibilityTable")
+
+// ---- T26: native sends into listener frames (UGMPBPLib::CallMessageFunction) -------------
+// FastCallScaleOut is void and all-POD, so the message arguments are written straight into the
+// invoked frame and the ref param is redirected to the sender's variable through OutParms.
+// UbergraphScaleOut is flagged as an ubergraph for the duration of the test: it is not eligible
+// for the direct frame and takes the parameter block + frame copy route instead. A native class
+// has no persistent ubergraph frame (UClass::GetPersistentUberGraphFrame returns null), so that
+// route ends up on a fresh frame, the copy-back is the same one a persistent frame gets.
+static bool Test_ListenerFrameOutParm()
+{
+	GMP_TEST_BEGIN("T26.CallMessageFunction listener frame ref writeback");
+	UGMPTestProbe* Probe = MakeTypedProbe();
+	UFunction* Direct = Probe->FindFunction(TEXT("FastCallScaleOut"));
+	UFunction* Uber = Probe->FindFunction(TEXT("UbergraphScaleOut"));
+	GMP_TEST_CHECK(Direct && Uber);
+	if (Direct && Uber)
+	{
+		int32 In = 21, Out = -1;
+		GMP::FTypedAddresses Args{FGMPTypedAddr::MakeMsg(In), FGMPTypedAddr::MakeMsg(Out)};
+		GMP_TEST_CHECK(UGMPBPLib::CallMessageFunction(Probe, Direct, Args));
+		GMP_TEST_CHECK(Probe->LastA == 21);
+		GMP_TEST_CHECK(Out == 42);  // written back to the sender
+
+		// writeback bit cleared for the ref: the listener writes into its own frame only
+		In = 5;
+		Out = -1;
+		GMP_TEST_CHECK(UGMPBPLib::CallMessageFunction(Probe, Direct, Args, 0x1));
+		GMP_TEST_CHECK(Probe->LastA == 5);
+		GMP_TEST_CHECK(Out == -1);
+
+		const EFunctionFlags OldFlags = Uber->FunctionFlags;
+		Uber->FunctionFlags |= FUNC_UbergraphFunction;
+		In = 8;
+		Out = -1;
+		GMP_TEST_CHECK(UGMPBPLib::CallMessageFunction(Probe, Uber, Args));
+		GMP_TEST_CHECK(Probe->LastA == 8);
+		GMP_TEST_CHECK(Out == 16);
+		GMP_TEST_CHECK(In == 8);  // value params are copied, never written back
+		In = 3;
+		Out = -1;
+		GMP_TEST_CHECK(UGMPBPLib::CallMessageFunction(Probe, Uber, Args, 0x1));
+		GMP_TEST_CHECK(Probe->LastA == 3);
+		GMP_TEST_CHECK(Out == -1);
+		Uber->FunctionFlags = OldFlags;
+	}
+	Probe->RemoveFromRoot();
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_ListenerFrameOutParm, "GMP.FastCall.ListenerFrameOutParm")
+
+// ---- SharedBPSendArgs: Blueprint listeners of one send share one argument list, a later send never matches it ----
+static bool Test_SharedBPSendArgs()
+{
+	GMP_TEST_BEGIN("SharedBPSendArgs");
+	UWorld* World = nullptr;
+	UGMPWorldProbe* Probes[3] = {MakeWorldProbe(World), nullptr, nullptr};
+	for (int32 i = 1; i < 3; ++i)
+	{
+		Probes[i] = NewObject<UGMPWorldProbe>(GetTransientPackage(), UGMPWorldProbe::StaticClass(), NAME_None, RF_Transient);
+		Probes[i]->TestWorld = World;
+		Probes[i]->AddToRoot();
+	}
+	const auto Key = MSGKEY("GMP.UT.SharedBPSendArgs");
+	const FName KeyName(Key);
+	for (auto Probe : Probes)
+		GMP_TEST_CHECK(UGMPBPLib::ListenMessageViaKey(Probe, KeyName, TEXT("FastCallScaleOut"), -1, 0, uint8(EMessageTypeBoth), 0, nullptr, FGMPObjNamePair{}).Value != 0);
+
+	auto Send = [&](int32 In) {
+		int32 Out = 0;
+		GMP::FTypedAddresses Params{FGMPTypedAddr::MakeMsg(In), FGMPTypedAddr::MakeMsg(Out)};
+		Hub()->ScriptNotifyMessage(Key, Params, FSigSource(World));
+	};
+	auto AllSaw = [&](int32 In) {
+		for (auto Probe : Probes)
+		{
+			if (Probe->LastA != In)
+				return false;
+		}
+		return true;
+	};
+
+	const int32 OldShare = GMP::GGMPShareBPSendArgs;
+	GMP::GGMPShareBPSendArgs = 1;
+	const uint32 Builds = GMP::GetBPSendArgsBuilds();
+	Send(3);
+	GMP_TEST_CHECK(GMP::GetBPSendArgsBuilds() == Builds + 1);  // built by the first listener, shared by the others
+	GMP_TEST_CHECK(AllSaw(3));
+	// same call site, so likely the same body and argument addresses: the first send's arguments are gone by now
+	Send(4);
+	GMP_TEST_CHECK(GMP::GetBPSendArgsBuilds() == Builds + 2);
+	GMP_TEST_CHECK(AllSaw(4));
+
+	// off, sends are not tracked and every listener builds its own arguments
+	GMP::GGMPShareBPSendArgs = 0;
+	Send(5);
+	GMP_TEST_CHECK(GMP::GetBPSendArgsBuilds() == Builds + 2);
+	GMP_TEST_CHECK(AllSaw(5));
+	GMP::GGMPShareBPSendArgs = OldShare;
+
+	for (auto Probe : Probes)
+	{
+		Hub()->ScriptUnbindMessage(KeyName, Probe);
+		Probe->RemoveFromRoot();
+	}
+	World->RemoveFromRoot();
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_SharedBPSendArgs, "GMP.FastCall.SharedBPSendArgs")
+
+// ---- FrameCopy: a function changed in place (same address and ParmsSize) gets a fresh plan after the field epoch ----
+// A transient UFunction stands in for a recompiled blueprint function: (int32, int32) is relinked as (int64), which
+// the cached plan's own checks can not tell apart. The GC moves the field epoch like reinstancing/hot reload would.
+static bool Test_FrameCopyPlanEpoch()
+{
+	GMP_TEST_BEGIN("FrameCopyPlanEpoch");
+	UFunction* Fn = NewObject<UFunction>(GetTransientPackage(), TEXT("GMPTestFrameCopyFn"), RF_Transient);
+	Fn->AddToRoot();
+	auto AddParm = [&](FProperty* Prop) {
+		Prop->SetPropertyFlags(CPF_Parm);
+		Fn->AddCppProperty(Prop);  // prepends, parameters are added last to first
+	};
+	AddParm(new FIntProperty(Fn, TEXT("B"), RF_NoFlags));
+	AddParm(new FIntProperty(Fn, TEXT("A"), RF_NoFlags));
+	Fn->StaticLink(true);
+	GMP_TEST_CHECK(Fn->ParmsSize == 8);
+
+	alignas(8) uint8 Frame[8] = {};
+	int32 A = 1, B = 2;
+	GMP::FTypedAddresses Args{FGMPTypedAddr::MakeMsg(A), FGMPTypedAddr::MakeMsg(B)};
+	GMP_TEST_CHECK(UGMPBPLib::MessageToFrame(Fn, Frame, Args));
+	GMP_TEST_CHECK(FMemory::Memcmp(Frame, &A, 4) == 0 && FMemory::Memcmp(Frame + 4, &B, 4) == 0);
+
+	Fn->DestroyChildPropertiesAndResetPropertyLinks();
+	AddParm(new FInt64Property(Fn, TEXT("A"), RF_NoFlags));
+	Fn->StaticLink(true);
+	GMP_TEST_CHECK(Fn->ParmsSize == 8);
+
+	const uint32 Epoch = GMP::Reflection::GetFieldEpoch();
+	CollectGarbage(RF_NoFlags, true);
+	GMP_TEST_CHECK(GMP::Reflection::GetFieldEpoch() != Epoch);
+
+	int64 C = 0x0102030405060708ll;
+	GMP::FTypedAddresses NewArgs{FGMPTypedAddr::MakeMsg(C)};
+	GMP_TEST_CHECK(UGMPBPLib::MessageToFrame(Fn, Frame, NewArgs));
+	GMP_TEST_CHECK(FMemory::Memcmp(Frame, &C, 8) == 0);
+	Fn->RemoveFromRoot();
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_FrameCopyPlanEpoch, "GMP.FastCall.FrameCopyPlanEpoch")
+
+// ---- CallByName: CallObjectFunctionByName runs on the FrameCopy plan cache (return values, non-POD, GC epoch) ----
+static bool Test_CallByNamePlan()
+{
+	GMP_TEST_BEGIN("CallByNamePlan");
+	UGMPTestProbe* Probe = MakeTypedProbe();
+	for (int32 Round = 0; Round < 2; ++Round)
+	{
+		int32 A = 2 + Round, B = 3, Ret = 0;
+		TArray<void*> AddPins{&A, &B, &Ret};
+		GMP_TEST_CHECK(UGMPBPLib::CallFunctionByName(Probe, TEXT("FastCallAddInts"), AddPins));
+		GMP_TEST_CHECK(Ret == A + B && Probe->LastA == A);
+
+		FString In = TEXT("x"), Out = TEXT("a"), Result;
+		TArray<void*> StrPins{&In, &Out, &Result};
+		GMP_TEST_CHECK(UGMPBPLib::CallFunctionByName(Probe, TEXT("FastCallAppendStr"), StrPins));
+		GMP_TEST_CHECK(Out == TEXT("ax") && Result == TEXT("R:x"));
+
+		// the shared plan still keeps functions with a return value off the message frame path
+		GMP::FTypedAddresses Args{FGMPTypedAddr::MakeMsg(A), FGMPTypedAddr::MakeMsg(B)};
+		alignas(16) uint8 Frame[16] = {};
+		GMP_TEST_CHECK(!UGMPBPLib::MessageToFrame(Probe->FindFunction(TEXT("FastCallAddInts")), Frame, Args));
+
+		// the second round runs on plans rebuilt after the field epoch moved
+		CollectGarbage(RF_NoFlags, true);
+	}
+	GMP_TEST_CHECK(!UGMPBPLib::CallFunctionByName(Probe, TEXT("GMPNoSuchFunction"), {}));
+	Probe->RemoveFromRoot();
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_CallByNamePlan, "GMP.FastCall.CallByNamePlan")
+
+// ---- BP argument arrays: per-thread pool of TArray<FGMPTypedAddr> + inline MakeFullParameters ----
+static bool Test_TypedAddrPool()
+{
+	GMP_TEST_BEGIN("TypedAddrPool");
+	int32 A = 1;
+	float B = 2.f;
+	const FGMPTypedAddr* Data = nullptr;
+	{
+		GMP::FPooledTypedAddrArray Outer;
+		Outer->Add(FGMPTypedAddr::MakeMsg(A));
+		Data = Outer->GetData();
+		{
+			// a nested send borrows its own array
+			GMP::FPooledTypedAddrArray Inner;
+			GMP_TEST_CHECK(&Inner.Get() != &Outer.Get());
+			GMP_TEST_CHECK(Inner->Num() == 0);
+		}
+		GMP_TEST_CHECK(Outer->Num() == 1);
+	}
+	{
+		// handed back emptied, the storage is reused
+		GMP::FPooledTypedAddrArray Again;
+		GMP_TEST_CHECK(Again->Num() == 0);
+		GMP_TEST_CHECK(Again->GetData() == Data);
+	}
+
+	GMP::FTypedAddresses Src{FGMPTypedAddr::MakeMsg(A), FGMPTypedAddr::MakeMsg(B)};
+	GMP_MSGBODY_ON_STACK(Body, Src.Num(), Src.GetData(), FName(TEXT("GMP.Test.TypedAddrPool")), FSigSource(nullptr), FGMPKey());
+	int32 OutCnt = 0;
+	GMP::FPooledTypedAddrArray InnerArr;
+	GMP::FTypedAddresses Full = Body.MakeFullParameters(0xf, OutCnt, InnerArr.Get());
+	GMP_TEST_CHECK(OutCnt == 4);
+	GMP_TEST_CHECK(Full.Num() == 6);
+	GMP_TEST_CHECK(Full.Max() == 8);  // still inline
+	GMP_TEST_CHECK(InnerArr->Num() == 2 && InnerArr.Get()[0].ToAddr() == &A);
+	GMP_TEST_CHECK(Full[4].ToAddr() == &A && Full[5].ToAddr() == &B);
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_TypedAddrPool, "GMP.Utils.TypedAddrPool")
+
+// ---- type registry: dense ids + cached ancestor / enum bitsets behind FNameSuccession ----
+static bool Test_TypeRegistry()
+{
+	GMP_TEST_BEGIN("TypeRegistry");
+	const FName ProbeName = FNameSuccession::GetNativeClassName(UGMPTestProbe::StaticClass());
+	const FName ObjectName = FNameSuccession::GetNativeClassName(UObject::StaticClass());
+	const FName FloatName = TClass2Name<float>::GetFName();
+	const FName ByteName = TClass2Name<uint8>::GetFName();
+	const FName EnumName = GMP::Class2Name::TTraitsEnumBase::GetFName(StaticEnum<ELocalSharedOverrideMode>());
+	const int32 ProbeId = FNameSuccession::GetTypeId(ProbeName);
+	GMP_TEST_CHECK(ProbeId == FNameSuccession::GetTypeId(ProbeName));
+	GMP_TEST_CHECK(ProbeId != FNameSuccession::GetTypeId(ObjectName));
+	// rounds 1 and 3 answer from the cached bitsets, round 2 rebuilds them after the invalidation
+	for (int32 Round = 0; Round < 3; ++Round)
+	{
+		if (Round == 2)
+			FNameSuccession::InvalidateTypeCache();
+		GMP_TEST_CHECK(FNameSuccession::IsDerivedFrom(ProbeName, ObjectName));
+		GMP_TEST_CHECK(FNameSuccession::IsDerivedFrom(ProbeName, ProbeName));
+		GMP_TEST_CHECK(!FNameSuccession::IsDerivedFrom(ObjectName, ProbeName));
+		GMP_TEST_CHECK(!FNameSuccession::MatchEnums(FloatName, ObjectName));
+		GMP_TEST_CHECK(FNameSuccession::MatchEnums(ByteName, EnumName));
+		GMP_TEST_CHECK(!FNameSuccession::MatchEnums(FloatName, EnumName));
+		GMP_TEST_CHECK(FNameSuccession::IsTypeCompatible(ByteName, EnumName));
+	}
+	GMP_TEST_CHECK(FNameSuccession::GetTypeId(ProbeName) == ProbeId);  // ids outlive invalidation
+
+	// classes renamed by recompiles never get an id, however often they are checked
+	const FName ReinstName(TEXT("REINST_GMPTestProbe_0"));
+	GMP_TEST_CHECK(!FNameSuccession::IsDerivedFrom(ReinstName, ObjectName));
+	GMP_TEST_CHECK(FNameSuccession::GetTypeId(ReinstName) == INDEX_NONE);
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_TypeRegistry, "GMP.Utils.TypeRegistry")
+
+// ---- stored messages share their runtime struct by parameter signature ----
+static bool Test_RuntimeStructSignatureCache()
+{
+	GMP_TEST_BEGIN("RuntimeStructSignatureCache");
+	int32 IntVal = 1;
+	FString StrVal = TEXT("str");
+	TArray<int32> IntArr;
+	TArray<float> FloatArr;
+	auto StoreType = [](const TCHAR* Key, const FGMPPropStackRefArray& Arr) {
+		FGMPStructUnion Union;
+		Union.InitAsMsgStore(Key, Arr);
+		return Union.GetType();
+	};
+
+	const FGMPPropStackRefArray IntStr{FGMPPropStackRef::MakePropStackRef(IntVal), FGMPPropStackRef::MakePropStackRef(StrVal)};
+	UScriptStruct* IntStrType = StoreType(TEXT("GMP.Test.SigCacheA"), IntStr);
+	GMP_TEST_CHECK(IntStrType && IntStrType == StoreType(TEXT("GMP.Test.SigCacheB"), IntStr));
+	GMP_TEST_CHECK(IntStrType == StoreType(TEXT("GMP.Test.SigCacheA"), IntStr));
+
+	const FGMPPropStackRefArray StrInt{FGMPPropStackRef::MakePropStackRef(StrVal), FGMPPropStackRef::MakePropStackRef(IntVal)};
+	UScriptStruct* StrIntType = StoreType(TEXT("GMP.Test.SigCacheA"), StrInt);
+	GMP_TEST_CHECK(StrIntType && StrIntType != IntStrType);
+
+	// same container, different inner type
+	const FGMPPropStackRefArray WithInts{FGMPPropStackRef::MakePropStackRef(IntVal), FGMPPropStackRef::MakePropStackRef(IntArr)};
+	const FGMPPropStackRefArray WithFloats{FGMPPropStackRef::MakePropStackRef(IntVal), FGMPPropStackRef::MakePropStackRef(FloatArr)};
+	UScriptStruct* IntsType = StoreType(TEXT("GMP.Test.SigCacheC"), WithInts);
+	UScriptStruct* FloatsType = StoreType(TEXT("GMP.Test.SigCacheC"), WithFloats);
+	GMP_TEST_CHECK(IntsType && FloatsType && IntsType != FloatsType);
+	GMP_TEST_CHECK(IntsType == StoreType(TEXT("GMP.Test.SigCacheD"), WithInts));
+
+#if WITH_EDITOR
+	// what OnPIEEnded does to the holder, the cached struct is still alive and gets registered again on its next hit
+	if (IntStrType)
+	{
+		auto Holder = GMP::Class2Prop::GMPGetMessagePropertiesHolder();
+		Holder->ClearProperties();
+		GMP_TEST_CHECK(!Holder->FindScriptStructByName(IntStrType->GetFName()));
+		GMP_TEST_CHECK(StoreType(TEXT("GMP.Test.SigCacheB"), IntStr) == IntStrType);
+		GMP_TEST_CHECK(Holder->FindScriptStructByName(IntStrType->GetFName()) == IntStrType);
+	}
+#endif
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_RuntimeStructSignatureCache, "GMP.Utils.RuntimeStructSignatureCache")
+
+// ---- ProcessBridge: host lifecycle over the shared-memory inbox + discovery lock ----
+// A single process can only be one participant per channel, so this covers the host half (lock, inbox, publish
+// without peers); the sidecar half needs a second process (gmp.bridge.start <Channel> on both sides).
+static bool Test_ProcessBridgeHostLifecycle()
+{
+	GMP_TEST_BEGIN("ProcessBridgeHostLifecycle");
+	const FString Channel = FString::Printf(TEXT("UnitTest%u"), FPlatformProcess::GetCurrentProcessId());
+	const FString LockPath = FGMPProcessBridge::GetLockFilePath(Channel);
+	{
+		FGMPProcessBridge Bridge;
+		GMP_TEST_CHECK(Bridge.Start(Channel, EGMPBridgeRole::Host, 64 * 1024, false));
+		GMP_TEST_CHECK(Bridge.IsRunning());
+		GMP_TEST_CHECK(Bridge.IsHost());
+		GMP_TEST_CHECK(IFileManager::Get().FileExists(*LockPath));
+		GMP_TEST_CHECK(Bridge.Subscribe(TEXT("GMP.Test.Bridge")));
+		GMP_TEST_CHECK(Bridge.Publish(TEXT("GMP.Test.Bridge"), int32(1), FString(TEXT("payload"))));
+		GMP_TEST_CHECK(Bridge.Pump() == 0);
+		GMP_TEST_CHECK(Bridge.GetPeerNum() == 0);
+		Bridge.Stop();
+		GMP_TEST_CHECK(!Bridge.IsRunning());
+	}
+	GMP_TEST_CHECK(!IFileManager::Get().FileExists(*LockPath));
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_ProcessBridgeHostLifecycle, "GMP.Bridge.HostLifecycle")
+
+// ---- ProcessBridge: a producer dying inside its reservation only costs that record ----
+// The dead producer is simulated by reserving under a pid that cannot exist and never committing, while a live
+// producer keeps publishing behind it (and wraps the ring). The consumer must skip exactly the dead record.
+static bool Test_ProcessBridgeStalledReservation()
+{
+	GMP_TEST_BEGIN("ProcessBridgeStalledReservation");
+	using namespace GMP::Bridge;
+	const uint32 SelfPid = FPlatformProcess::GetCurrentProcessId();
+	const uint32 DeadPid = 0x7FFFFFFF;
+	auto Ring = FRing::Create(FString::Printf(TEXT("GMPBridgeTest_%u"), SelfPid), 4 * 1024);
+	GMP_TEST_CHECK(Ring.IsValid());
+	if (Ring.IsValid())
+	{
+		Ring->StallTimeout = 0.0;
+		TArray<int32> Received;
+		auto Collect = [&](uint16 Kind, uint32 SenderPid, const uint8* Data, int32 Size) {
+			if (Kind == Publish && SenderPid == SelfPid && Size == sizeof(int32))
+				Received.Add(*reinterpret_cast<const int32*>(Data));
+		};
+		auto Send = [&](int32 Value) { return Ring->Write(Publish, SelfPid, reinterpret_cast<const uint8*>(&Value), sizeof(Value)); };
+
+		int64 DeadPos = 0;
+		GMP_TEST_CHECK(Ring->Reserve(DeadPid, 100, DeadPos));
+		for (int32 i = 0; i < 3; ++i)
+			GMP_TEST_CHECK(Send(i));
+		GMP_TEST_CHECK(Ring->Consume(0, Collect) == 0);  // first sight of the stall only arms the timer
+		GMP_TEST_CHECK(Ring->Consume(0, Collect) == 3);
+		GMP_TEST_CHECK(Received == TArray<int32>({0, 1, 2}));
+		GMP_TEST_CHECK(Ring->Header->ReadHead == Ring->Header->WriteHead);
+
+		// a live owner is waited on, its record is delivered in order once committed
+		int64 LivePos = 0;
+		const int32 LiveValue = 100;
+		GMP_TEST_CHECK(Ring->Reserve(SelfPid, sizeof(int32), LivePos));
+		GMP_TEST_CHECK(Send(101));
+		GMP_TEST_CHECK(Ring->Consume(0, Collect) == 0);
+		GMP_TEST_CHECK(Ring->Consume(0, Collect) == 0);
+		Ring->Commit(LivePos, Publish, reinterpret_cast<const uint8*>(&LiveValue), sizeof(LiveValue));
+		GMP_TEST_CHECK(Ring->Consume(0, Collect) == 2);
+		GMP_TEST_CHECK(Received.Num() == 5 && Received[3] == 100 && Received[4] == 101);
+
+		// keep going across several wraps with a dead reservation in every lap
+		Received.Reset();
+		int32 Next = 0;
+		for (int32 Lap = 0; Lap < 8; ++Lap)
+		{
+			GMP_TEST_CHECK(Ring->Reserve(DeadPid, 200, DeadPos));
+			for (int32 i = 0; i < 40; ++i)
+				GMP_TEST_CHECK(Send(Next++));
+			Ring->Consume(0, Collect);
+			Ring->Consume(0, Collect);
+		}
+		GMP_TEST_CHECK(Received.Num() == Next);
+		for (int32 i = 0; i < Received.Num(); ++i)
+			GMP_TEST_CHECK(Received[i] == i);
+		GMP_TEST_CHECK(Ring->Header->ReadHead == Ring->Header->WriteHead);
+	}
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_ProcessBridgeStalledReservation, "GMP.Bridge.StalledReservation")
+
+// ---- Serializer: per-struct visit plan (flattened fields + kinds) drives the json codec ----
+static bool Test_SerializerVisitPlan()
+{
+	GMP_TEST_BEGIN("SerializerVisitPlan");
+	using namespace GMP::Serializer::Traits;
+	UScriptStruct* LeafStruct = FGMPBenchLeaf::StaticStruct();
+	auto Plan = GetStructVisitPlan(LeafStruct);
+	GMP_TEST_CHECK(Plan->Props.Num() == 4);
+	if (Plan->Props.Num() == 4)
+	{
+		GMP_TEST_CHECK(Plan->Props[0].Kind == EPropKind::Int && Plan->Props[0].Property->GetOffset_ForInternal() == STRUCT_OFFSET(FGMPBenchLeaf, Id));
+		GMP_TEST_CHECK(Plan->Props[1].Kind == EPropKind::Float && Plan->Props[1].Property->GetOffset_ForInternal() == STRUCT_OFFSET(FGMPBenchLeaf, Weight));
+		GMP_TEST_CHECK(Plan->Props[2].Kind == EPropKind::Str && Plan->Props[2].Property->GetOffset_ForInternal() == STRUCT_OFFSET(FGMPBenchLeaf, Label));
+		GMP_TEST_CHECK(Plan->Props[3].Kind == EPropKind::Struct && Plan->Props[3].Property->GetOffset_ForInternal() == STRUCT_OFFSET(FGMPBenchLeaf, Pos));
+	}
+	GMP_TEST_CHECK(&GetStructVisitPlan(LeafStruct).Get() == &Plan.Get());
+	auto LabelVisit = Plan->FindByAuthoredName(TEXT("Label"));
+	GMP_TEST_CHECK(!Plan->bUserDefined && LabelVisit && LabelVisit->Kind == EPropKind::Str);
+	GMP_TEST_CHECK(LabelVisit && LabelVisit->AuthoredString.Equals(TEXT("Label"), ESearchCase::CaseSensitive));
+	GMP_TEST_CHECK(!Plan->FindByAuthoredName(TEXT("Missing")));
+	InvalidateStructVisitPlan(LeafStruct);
+	GMP_TEST_CHECK(GetStructVisitPlan(LeafStruct)->Props.Num() == Plan->Props.Num());
+	// the GC moves the field epoch, every plan is rebuilt after it
+	auto BeforeGC = GetStructVisitPlan(LeafStruct);
+	CollectGarbage(RF_NoFlags, true);
+	GMP_TEST_CHECK(&GetStructVisitPlan(LeafStruct).Get() != &BeforeGC.Get());
+	GMP_TEST_CHECK(GetPropKind(FGMPBenchBranch::StaticStruct()->FindPropertyByName(TEXT("Leaves"))) == EPropKind::Array);
+
+	FGMPBenchBranch Branch;
+	Branch.Head.Id = 7;
+	Branch.Head.Label = TEXT("head");
+	Branch.Leaves.AddDefaulted(2);
+	Branch.Leaves[1].Weight = 0.5f;
+	Branch.Leaves[1].Pos = FVector(1.0, 2.0, 3.0);
+	FString Str;
+	GMP_TEST_CHECK(GMP::Json::UStructToJson(Str, Branch));
+
+	FGMPBenchBranch Decoded;
+	GMP_TEST_CHECK(GMP::Json::UStructFromJson(Str, Decoded));
+	GMP_TEST_CHECK(Decoded.Head.Id == 7 && Decoded.Head.Label == TEXT("head"));
+	GMP_TEST_CHECK(Decoded.Leaves.Num() == 2);
+	GMP_TEST_CHECK(Decoded.Leaves.Num() == 2 && Decoded.Leaves[1].Weight == 0.5f && Decoded.Leaves[1].Pos == FVector(1.0, 2.0, 3.0));
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_SerializerVisitPlan, "GMP.Serializer.VisitPlan")
+
+// ---- FGMPValuePath: compiled multi-level lookup into a json FGMPValueOneOf ----
+static bool Test_ValueOneOfPath()
+{
+	GMP_TEST_BEGIN("ValueOneOfPath");
+	FGMPValueOneOf Val;
+	GMP_TEST_CHECK(Val.FromJsonStr(TEXT("{\"Root\":{\"Inner\":{\"Count\":42,\"Label\":\"deep\"},\"Flag\":true}}")));
+
+	const FGMPValuePath CountPath(TEXT("Root/Inner/Count"));
+	GMP_TEST_CHECK(CountPath.Num() == 3 && CountPath.GetKey(1) == FName(TEXT("Inner")));
+	int32 Count = 0;
+	GMP_TEST_CHECK(Val.AsValue(Count, CountPath) && Count == 42);
+	FString Label;
+	GMP_TEST_CHECK(Val.AsValue(Label, FGMPValuePath(TEXT("root.inner.label"))) && Label == TEXT("deep"));
+	bool bFlag = false;
+	GMP_TEST_CHECK(Val.AsValue(bFlag, MakeArrayView<FName>({TEXT("Root"), TEXT("Flag")})) && bFlag);
+	GMP_TEST_CHECK(!Val.AsValue(Count, FGMPValuePath(TEXT("Root/Missing/Count"))));
+	GMP_TEST_CHECK(!Val.AsValue(Count, FGMPValuePath(TEXT("Root/Flag/Count"))));
+
+	int32 Pointed = 0;
+	GMP_TEST_CHECK(FGMPValueOneOf::PointValue(Pointed, TEXT("{\"a\":{\"b\":7}}"), TEXT("a"), TEXT("b")) && Pointed == 7);
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_ValueOneOfPath, "GMP.Serializer.ValueOneOfPath")
+
+// ---- FGMPValueOneOf::LoadFromFile through a file mapping, compared against the archive reader ----
+static bool Test_ValueOneOfMappedLoad()
+{
+	GMP_TEST_BEGIN("ValueOneOfMappedLoad");
+	const FString FilePath = FPaths::CreateTempFilename(*FPaths::ProjectSavedDir(), TEXT("GMPOneOf"), TEXT(".json"));
+	GMP_TEST_CHECK(FFileHelper::SaveStringToFile(TEXT("{\"Table\":{\"Rows\":3,\"Name\":\"mapped\"}}"), *FilePath, FFileHelper::EEncodingOptions::ForceUTF8));
+
+	FGMPValueOneOf Mapped;
+	FGMPValueOneOf Read;
+	GMP_TEST_CHECK(Mapped.LoadFromFile(FilePath, false, true));
+	GMP_TEST_CHECK(Read.LoadFromFile(FilePath));
+	int32 MappedRows = 0;
+	int32 ReadRows = 0;
+	FString MappedName;
+	GMP_TEST_CHECK(Mapped.AsValue(MappedRows, FGMPValuePath(TEXT("Table/Rows"))) && MappedRows == 3);
+	GMP_TEST_CHECK(Read.AsValue(ReadRows, FGMPValuePath(TEXT("Table/Rows"))) && ReadRows == MappedRows);
+	GMP_TEST_CHECK(Mapped.AsValue(MappedName, FGMPValuePath(TEXT("Table/Name"))) && MappedName == TEXT("mapped"));
+	IFileManager::Get().Delete(*FilePath);
+
+	FGMPValueOneOf Missing;
+	GMP_TEST_CHECK(!Missing.LoadFromFile(FilePath, false, true) && !Missing.IsValid());
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_ValueOneOfMappedLoad, "GMP.Serializer.ValueOneOfMappedLoad")
+
+// ---- union delta: a dropped payload must not leave the receiving shadow stale ----
+static bool Test_UnionNetDeltaResync()
+{
+	GMP_TEST_BEGIN("UnionNetDeltaResync");
+	IConsoleVariable* CVarDelta = IConsoleManager::Get().FindConsoleVariable(TEXT("gmp.net.UnionDelta"));
+	GMP_TEST_CHECK(CVarDelta);
+	if (!CVarDelta)
+		return false;
+	const int32 PrevDelta = CVarDelta->GetInt();
+	CVarDelta->Set(0, ECVF_SetByCode);
+	GMP_TEST_CHECK(!IsUnionNetDeltaEnabled());
+	CVarDelta->Set(1, ECVF_SetByCode);
+	GMP_TEST_CHECK(IsUnionNetDeltaEnabled());
+
+	// one package map stands for both ends, the shadow keeps sent and received states apart
+	UPackageMap* Map = NewObject<UGMPTestPackageMap>();
+	auto Write = [&](int32 Id, const TCHAR* Label) {
+		FGMPBenchLeaf Leaf;
+		Leaf.Id = Id;
+		Leaf.Label = Label;
+		FGMPStructUnion Union(Leaf);
+		FGMPNetBitWriter Writer(Map, 0);
+		{
+			FUnionNetDeltaScope DeltaScope(Map);
+			bool bSucc = false;
+			Union.NetSerialize(Writer, Map, bSucc);
+		}
+		return TPair<TArray<uint8>, int64>(*Writer.GetBuffer(), Writer.GetNumBits());
+	};
+	auto Read = [&](TPair<TArray<uint8>, int64>& Payload, FGMPBenchLeaf& Out) {
+		FGMPNetBitReader Reader(Map, Payload.Key.GetData(), Payload.Value);
+		FGMPStructUnion Union;
+		bool bSucc = false;
+		Union.NetSerialize(Reader, Map, bSucc);
+		return bSucc && !Reader.IsError() && Union.GetDynamicStruct(Out);
+	};
+
+	FGMPBenchLeaf Decoded;
+	auto First = Write(1, TEXT("first"));
+	GMP_TEST_CHECK(Read(First, Decoded) && Decoded.Id == 1 && Decoded.Label == TEXT("first"));
+
+	// dropped on the receiving end: the sender has advanced its baseline, the receiver has not
+	Write(2, TEXT("dropped"));
+	ResetUnionNetReceiveShadow(Map);
+
+	// written before the sender learned about the drop, fails instead of decoding against a stale baseline
+	auto InFlight = Write(3, TEXT("dropped"));
+	GMP_TEST_CHECK(!Read(InFlight, Decoded));
+
+	ResetUnionNetShadow(Map);
+	auto Next = Write(4, TEXT("dropped"));
+	GMP_TEST_CHECK(Read(Next, Decoded) && Decoded.Id == 4 && Decoded.Label == TEXT("dropped"));
+	auto Delta = Write(5, TEXT("dropped"));
+	GMP_TEST_CHECK(Read(Delta, Decoded) && Decoded.Id == 5 && Decoded.Label == TEXT("dropped"));
+
+	ResetUnionNetShadow(Map);
+	ResetUnionNetReceiveShadow(Map);
+	CVarDelta->Set(PrevDelta, ECVF_SetByCode);
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_UnionNetDeltaResync, "GMP.Serializer.UnionNetDeltaResync")
+
+// ---- LocalSharedStorage typed slots: O(1) access, versions and change notification ----
+static bool Test_LocalSharedSlot()
+{
+	GMP_TEST_BEGIN("LocalSharedSlot");
+	const FName Key = TEXT("GMP.UT.SharedSlot");
+	const auto NotifyKey = MSGKEY("GMP.UT.SharedSlotChanged");
+	// the null context is the process wide storage, start from an empty key in case an earlier run stopped halfway
+	ULocalSharedStorage::RemoveLocalSharedStorage(nullptr, Key);
+	FSigHandle Handle;
+	int32 Notified = 0;
+	int32 LastVersion = 0;
+	Hub()->ListenObjectMessage(NotifyKey, FSigSource(ULocalSharedStorage::GetStorageSource(nullptr)), &Handle, [&](FName InKey, int32 InVersion) {
+		Notified += InKey == Key;
+		LastVersion = InVersion;
+	});
+
+	auto Slot = ULocalSharedStorage::FindOrAddSlot<int32>(nullptr, Key, NotifyKey);
+	GMP_TEST_CHECK(Slot.IsValid() && !Slot.Get());
+	uint32 Seen = Slot.GetVersion();
+	GMP_TEST_CHECK(Slot.Set(5) && Slot.Get() && *Slot.Get() == 5);
+	GMP_TEST_CHECK(Slot.HasChanged(Seen) && !Slot.HasChanged(Seen));
+	GMP_TEST_CHECK(!Slot.Set(6, ELocalSharedOverrideMode::Skip) && *Slot.Get() == 5);
+
+	// writes through the FName api reach the slot as well
+	int32 Value = 9;
+	GMP_TEST_CHECK(ULocalSharedStorage::SetLocalSharedStorage(nullptr, Key, Value, ELocalSharedOverrideMode::Override));
+	GMP_TEST_CHECK(*Slot.Get() == 9 && Slot.HasChanged(Seen));
+	GMP_TEST_CHECK(Notified == 2 && LastVersion == int32(Slot.GetVersion()));
+
+	auto Again = ULocalSharedStorage::FindOrAddSlot<int32>(nullptr, Key);
+	GMP_TEST_CHECK(Again.Get() == Slot.Get());
+
+	GMP_TEST_CHECK(ULocalSharedStorage::RemoveLocalSharedStorage(nullptr, Key));
+	GMP_TEST_CHECK(!Slot.Get() && Slot.HasChanged(Seen) && Notified == 3);
+	GMP_TEST_CHECK(!ULocalSharedStorage::GetLocalSharedStorage<int32>(nullptr, Key));
+	GMP_TEST_CHECK(!ULocalSharedStorage::RemoveLocalSharedStorage(nullptr, Key));
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_LocalSharedSlot, "GMP.LocalShared.Slot")
+
+static bool Test_LuaRewrite()
+{
+	GMP_TEST_BEGIN("LuaRewrite");
+	const FString Plain = TEXT("local a = 1\nprint(a)\n");
+	GMP_TEST_CHECK(GMPLuaRewrite::Rewrite(Plain) == Plain);
+
+	const FString Src = TEXT("NotifyObjectMessage(self, \"Player.Hurt\", 1, { x = f(2, 3) })\n")
+						TEXT("-- NotifyObjectMessage(self, \"In.Comment\")\n")
+						TEXT("--[==[ NotifyObjectMessage(self, \"In.Block\") ]] ]==]\n")
+						TEXT("local s = [[NotifyObjectMessage(self, \"In.Long\")]]\n")
+						TEXT("NotifyObjectMessage (obj,'A-B')");
+	const FString Expected = TEXT("Notify_Player_Hurt(self, 1, { x = f(2, 3) })\n")
+							 TEXT("-- NotifyObjectMessage(self, \"In.Comment\")\n")
+							 TEXT("--[==[ NotifyObjectMessage(self, \"In.Block\") ]] ]==]\n")
+							 TEXT("local s = [[NotifyObjectMessage(self, \"In.Long\")]]\n")
+							 TEXT("Notify_A_B(obj)");
+	GMP_TEST_CHECK(GMPLuaRewrite::Rewrite(Src) == Expected);
+
+	// second call is served by the disk cache and must be byte identical
+	TArray<uint8> First;
+	TArray<uint8> Second;
+	GMPLuaRewrite::RewriteToUtf8(Src, First);
+	GMPLuaRewrite::RewriteToUtf8(Src, Second);
+	FTCHARToUTF8 ExpectedUtf8(*Expected);
+	GMP_TEST_CHECK(First.Num() == ExpectedUtf8.Length() && FMemory::Memcmp(First.GetData(), ExpectedUtf8.Get(), First.Num()) == 0);
+	GMP_TEST_CHECK(First == Second);
+
+#if GMP_LUA_REWRITE_CACHE
+	// an edited source file replaces its cached chunk instead of adding another one
+	const FString SourcePath = FPaths::ProjectSavedDir() / TEXT("GMPUnitTest") / TEXT("LuaRewrite.lua");
+	const FString Edited = Src + TEXT("\n");
+	TArray<uint8> Old;
+	TArray<uint8> New;
+	GMPLuaRewrite::RewriteToUtf8(Src, Old, SourcePath);
+	const FString OldPath = GMPLuaRewrite::GetCachePath(GMPLuaRewrite::GetCacheKey(Src), SourcePath);
+	GMP_TEST_CHECK(FPaths::FileExists(OldPath));
+	GMPLuaRewrite::RewriteToUtf8(Edited, New, SourcePath);
+	const FString NewPath = GMPLuaRewrite::GetCachePath(GMPLuaRewrite::GetCacheKey(Edited), SourcePath);
+	GMP_TEST_CHECK(FPaths::FileExists(NewPath) && !FPaths::FileExists(OldPath));
+	GMP_TEST_CHECK(FPaths::FileExists(GMPLuaRewrite::GetCachePath(GMPLuaRewrite::GetCacheKey(Src))));
+	IFileManager::Get().Delete(*NewPath, false, false, true);
+#endif
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_LuaRewrite, "GMP.Script.LuaRewrite")
+
+// ---- Format: K2Node_FormatStr bakes literal named formats into ordered ones at compile time ----
+static bool Test_FormatBake()
+{
+	GMP_TEST_BEGIN("FormatBake");
+	const TArray<FString> Names = {TEXT("Name"), TEXT("Count")};
+	FString Baked;
+	GMP_TEST_CHECK(UGMPBPLib::BakeFormatByName(TEXT("{name} has {Count} } items, {Name}"), Names, Baked));
+	GMP_TEST_CHECK(Baked == TEXT("{0} has {1} } items, {0}"));
+	GMP_TEST_CHECK(UGMPBPLib::BakeFormatByName(TEXT(""), Names, Baked) && Baked.IsEmpty());
+	// unresolved names and escapes stay on the by-name path
+	GMP_TEST_CHECK(!UGMPBPLib::BakeFormatByName(TEXT("{Missing}"), Names, Baked));
+	GMP_TEST_CHECK(!UGMPBPLib::BakeFormatByName(TEXT("`{Name} {Count}"), Names, Baked));
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_FormatBake, "GMP.Utils.FormatBake")
+
+// ---- MemberChain: cached chain runs never resolve an empty chain or cache a failed one ----
+static bool Test_MemberChainResolve()
+{
+	GMP_TEST_BEGIN("MemberChainResolve");
+	auto* Outer = NewObject<UGMPTestChainHolder>();
+	auto* Inner = NewObject<UGMPTestChainHolder>();
+	Outer->Next = Inner;
+	Outer->Branch.Head.Id = 3;
+	Inner->Branch.Head.Id = 7;
+	FProperty* IdProp = FGMPBenchLeaf::StaticStruct()->FindPropertyByName(TEXT("Id"));
+	GMP_TEST_CHECK(IdProp);
+	if (!IdProp)
+		return false;
+
+	int32 Out = -1;
+	// zero segments, twice so a cached run would be hit the second time
+	for (int32 i = 0; i < 2; ++i)
+		GMP_TEST_CHECK(!UGMPBPLib::CopyMemberByChainName(Outer, TEXT("."), IdProp, &Out) && Out == -1);
+	for (int32 i = 0; i < 2; ++i)
+		GMP_TEST_CHECK(!UGMPBPLib::CopyMemberByChainName(Outer, TEXT("Branch.Missing.Id"), IdProp, &Out) && Out == -1);
+	// leaf of another type than the output
+	GMP_TEST_CHECK(!UGMPBPLib::CopyMemberByChainName(Outer, TEXT("Branch.Head.Label"), IdProp, &Out) && Out == -1);
+
+	for (int32 i = 0; i < 2; ++i)
+	{
+		GMP_TEST_CHECK(UGMPBPLib::CopyMemberByChainName(Outer, TEXT("Branch.Head.Id"), IdProp, &Out) && Out == 3);
+		GMP_TEST_CHECK(UGMPBPLib::CopyMemberByChainName(Outer, TEXT("Next.Branch.Head.Id"), IdProp, &Out) && Out == 7);
+	}
+	Inner->Branch.Head.Id = 9;
+	GMP_TEST_CHECK(UGMPBPLib::CopyMemberByChainName(Outer, TEXT("Next.Branch.Head.Id"), IdProp, &Out) && Out == 9);
+	// the object hop follows the runtime pointer, a null one fails
+	Outer->Next = nullptr;
+	Out = -1;
+	GMP_TEST_CHECK(!UGMPBPLib::CopyMemberByChainName(Outer, TEXT("Next.Branch.Head.Id"), IdProp, &Out) && Out == -1);
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_MemberChainResolve, "GMP.Utils.MemberChainResolve")
+
+// ---- WorldIndex: world local slots are reused across worlds and never handed out after cleanup ----
+struct FGMPTestWorldLocal
+{
+	int32 Value = 0;
+};
+static bool Test_WorldIndexReuse()
+{
+	GMP_TEST_BEGIN("world index reuse across world cleanup");
+	using FOps = GMP::WorldLocals::TInlineOps<UWorld>;
+	auto& Storage = FOps::GetStorage<FGMPTestWorldLocal>();
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Inactive, false);
+	World->AddToRoot();
+	UGMPWorldProbe* Probe = NewObject<UGMPWorldProbe>(GetTransientPackage(), UGMPWorldProbe::StaticClass(), NAME_None, RF_Transient);
+	Probe->TestWorld = World;
+	Probe->AddToRoot();
+
+	// the indexed slot, the world itself and any object in it reach the same storage
+	FGMPTestWorldLocal* Val = FOps::LocalObject<FGMPTestWorldLocal>(World);
+	Val->Value = 7;
+	const int32 Idx = GMP::WorldLocals::GetWorldIndex(World, false);
+	GMP_TEST_CHECK(Idx > GMP::WorldLocals::RetiredWorldIndex);
+	GMP_TEST_CHECK(Storage.IsValidIndex(Idx) && Storage[Idx].Object.Get() == Val);
+	GMP_TEST_CHECK(FOps::LocalPtr<FGMPTestWorldLocal>(World) == Val);
+	GMP_TEST_CHECK(FOps::LocalPtr<FGMPTestWorldLocal>(Probe) == Val);
+	GMP_TEST_CHECK(FOps::LocalObject<FGMPTestWorldLocal>(Probe) == Val);
+
+	// cleanup clears the slot and a late access only gets the retired slot
+	World->DestroyWorld(false);
+	GMP_TEST_CHECK(!Storage[Idx].Object.IsValid());
+	GMP_TEST_CHECK(FOps::LocalPtr<FGMPTestWorldLocal>(World) == nullptr);
+	GMP_TEST_CHECK(GMP::WorldLocals::GetWorldIndex(World) == GMP::WorldLocals::RetiredWorldIndex);
+	FGMPTestWorldLocal* Late = FOps::LocalObject<FGMPTestWorldLocal>(World);
+	GMP_TEST_CHECK(Late && Late != Val && Late->Value == 0);
+	GMP_TEST_CHECK(GMP::WorldLocals::GetWorldIndex(World, false) == GMP::WorldLocals::RetiredWorldIndex);
+
+	// the next world takes the freed index over with fresh storage
+	UWorld* World2 = UWorld::CreateWorld(EWorldType::Inactive, false);
+	World2->AddToRoot();
+	GMP_TEST_CHECK(GMP::WorldLocals::GetWorldIndex(World2) == Idx);
+	GMP_TEST_CHECK(FOps::LocalPtr<FGMPTestWorldLocal>(World2) == nullptr);
+	GMP_TEST_CHECK(FOps::LocalObject<FGMPTestWorldLocal>(World2)->Value == 0);
+	World2->DestroyWorld(false);
+	GMP_TEST_CHECK(GMP::WorldLocals::GetWorldIndex(World2, false) == GMP::WorldLocals::RetiredWorldIndex);
+
+	Probe->RemoveFromRoot();
+	World->RemoveFromRoot();
+	World2->RemoveFromRoot();
+	CollectGarbage(RF_NoFlags, true);
+	GMP_TEST_CHECK(!Storage[GMP::WorldLocals::RetiredWorldIndex].Object.IsValid());
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_WorldIndexReuse, "GMP.Utils.WorldIndexReuse")
+
+#if GMP_WITH_TRACE_CHANNEL
+// ---- Trace: in-process aggregation of per-key send cost and per-listener cost ----
+static bool Test_TraceStatsAggregation()
+{
+	GMP_TEST_BEGIN("TraceStatsAggregation");
+	UObject* Src = MakeProbe();
+	const FName Key = TEXT("GMP.UT.Trace.Stats");
+	const int32 OldStats = Trace::GGMPTraceStats;
+	Trace::GGMPTraceStats = 1;
+	Trace::ResetStats();
+
+	int32 Hits = 0;
+	FSigHandle HA, HB;
+	Hub()->ListenObjectMessage(MSGKEY("GMP.UT.Trace.Stats"), Src, &HA, [&](int32 V) { Hits += V; });
+	Hub()->ListenObjectMessage(MSGKEY("GMP.UT.Trace.Stats"), Src, &HB, [&](int32 V) { Hits += V; });
+	for (int32 i = 0; i < 3; ++i)
+		Hub()->SendObjectMessage(MSGKEY("GMP.UT.Trace.Stats"), Src, int32(1));
+	GMP_TEST_CHECK(Hits == 6);
+
+	TArray<Trace::FKeyStats> Keys;
+	Trace::GetKeyStats(Keys);
+	auto KeyStats = Keys.FindByPredicate([&](const Trace::FKeyStats& Stats) { return Stats.Key == Key; });
+	GMP_TEST_CHECK(KeyStats && KeyStats->Sends == 3);
+	GMP_TEST_CHECK(KeyStats && KeyStats->Listeners == 6);
+	GMP_TEST_CHECK(KeyStats && KeyStats->PayloadBytes == 3 * sizeof(int32));
+
+	TArray<Trace::FListenerStats> Listeners;
+	Trace::GetListenerStats(Listeners);
+	int32 KeyListeners = 0;
+	for (auto& Stats : Listeners)
+	{
+		if (Stats.Key == Key)
+		{
+			++KeyListeners;
+			GMP_TEST_CHECK(Stats.Calls == 3);
+		}
+	}
+	GMP_TEST_CHECK(KeyListeners == 2);
+
+	Trace::ResetStats();
+	Trace::GGMPTraceStats = OldStats;
+	Src->RemoveFromRoot();
+	GMP_TEST_END();
+}
+GMP_IMPLEMENT_AUTOMATION_TEST(Test_TraceStatsAggregation, "GMP.Trace.StatsAggregation")
+#endif
+
 // ---- Benchmark (moved here from GMPHub.cpp; benchmarks belong in the test file) ----
 // Per-broadcast cost: native MulticastDelegate vs GMP FName-send vs GMP slot-send vs GMP typed pass-through.
 // Run: -run=GMPUnitTest -Bench   (default 8 listeners x 1,000,000 iters). Uses an object source (no world needed).
@@ -2370,6 +3271,14 @@ int32 RunAllGMPTests(const FString& Params)
 	Test_FastCallVoidZeroArg();
 	Test_FastCallLayoutMismatchFallback();
 	Test_FastCallNonPodRefAndReturn();
+	Test_FastCallEligibilityTable();
+	Test_ListenerFrameOutParm();
+	Test_SharedBPSendArgs();
+	Test_FrameCopyPlanEpoch();
+	Test_CallByNamePlan();
+	Test_TypedAddrPool();
+	Test_TypeRegistry();
+	Test_RuntimeStructSignatureCache();
 #if GMP_WITH_DIRECT_SIGNAL
 	if (!bNoDirect)
 	{
@@ -2390,6 +3299,7 @@ int32 RunAllGMPTests(const FString& Params)
 	Test_StaticDisconnectByKey();
 #endif
 	Test_AutoInvalidationPurgesStaleListenerImmediately();
+	Test_MemoryStatsStaleListener();
 
 	// FSigSource forms
 	Test_SourceObjectIsolation();
@@ -2411,6 +3321,20 @@ int32 RunAllGMPTests(const FString& Params)
 	Test_EquivStoreInterfaceParam();
 	Test_EquivLiveInterfaceParam();
 	Test_ReqRspProxyRoundTrip();  // migrated from UGMPRpcProxy::BeginPlay bTest sample (ReqRsp half)
+	Test_ProcessBridgeHostLifecycle();
+	Test_ProcessBridgeStalledReservation();
+	Test_SerializerVisitPlan();
+	Test_ValueOneOfPath();
+	Test_ValueOneOfMappedLoad();
+	Test_UnionNetDeltaResync();
+	Test_LocalSharedSlot();
+	Test_LuaRewrite();
+	Test_FormatBake();
+	Test_MemberChainResolve();
+	Test_WorldIndexReuse();
+#if GMP_WITH_TRACE_CHANNEL
+	Test_TraceStatsAggregation();
+#endif
 #if GMP_WITH_DIRECT_SIGNAL
 	if (!bNoDirect)
 	{
@@ -2432,6 +3356,9 @@ int32 RunAllGMPTests(const FString& Params)
 #endif
 		Test_TypedRefWriteback();
 		Test_TypedMixedQualifiers();
+#if GMP_WITH_DYNAMIC_CALL_CHECK
+		Test_SignatureCheckMemo();
+#endif
 #if !GMP_WITH_STATIC_STORE  // modular-only mechanics (lazy ResolvePtr / duplicate OwnerSlot)
 		Test_LazySlotResolve();
 		Test_DuplicateSlotResolveKeepsCanonicalOwner();
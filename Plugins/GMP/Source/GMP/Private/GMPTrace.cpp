@@ -0,0 +1,263 @@
+//  Copyright GenericMessagePlugin, Inc. All Rights Reserved.
+
+#include "GMPTrace.h"
+
+#if GMP_WITH_TRACE_CHANNEL
+#include "GMPClass2Prop.h"
+#include "GMPSignalsImpl.h"
+#include "HAL/PlatformTime.h"
+#include "XConsoleManager.h"
+
+#if UE_5_00_OR_LATER
+#define GMP_TRACE_WIDESTRING UE::Trace::WideString
+#else
+#define GMP_TRACE_WIDESTRING Trace::WideString
+#endif
+
+UE_TRACE_CHANNEL_DEFINE(GMPChannel)
+
+UE_TRACE_EVENT_BEGIN(GMP, MessageKey, NoSync | Important)
+	UE_TRACE_EVENT_FIELD(uint32, KeyId)
+	UE_TRACE_EVENT_FIELD(GMP_TRACE_WIDESTRING, Name)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(GMP, Send)
+	UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+	UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+	UE_TRACE_EVENT_FIELD(uint32, KeyId)
+	UE_TRACE_EVENT_FIELD(uint32, ListenerCount)
+	UE_TRACE_EVENT_FIELD(uint32, PayloadBytes)
+	UE_TRACE_EVENT_FIELD(uint16, ParamCount)
+	UE_TRACE_EVENT_FIELD(uint8, SourceKind)
+	UE_TRACE_EVENT_FIELD(uint8, Depth)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(GMP, Listener)
+	UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+	UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+	UE_TRACE_EVENT_FIELD(uint64, HandlerId)
+	UE_TRACE_EVENT_FIELD(uint32, KeyId)
+UE_TRACE_EVENT_END()
+
+namespace GMP
+{
+namespace Trace
+{
+	int32 GGMPTraceStats = 0;
+	static FXConsoleVariableRef CVarGMPTraceStats(TEXT("gmp.trace.stats"), GGMPTraceStats, TEXT("Aggregate per-key send cost and per-listener cost in process (0=off, 1=on), see gmp.trace.dump"));
+
+	namespace Details
+	{
+		// dispatch is game thread only, so is everything below
+		static FSendScope* CurrentSend = nullptr;
+		static uint8 SendDepth = 0;
+		static TSet<FName> EmittedKeys;
+		static TMap<FName, uint32> PayloadBytesCache;
+		static TMap<FName, FKeyStats> KeyStats;
+		static TMap<uint64, FListenerStats> ListenerStats;
+
+		static uint32 GetKeyId(const FName& Key) { return Key.GetComparisonIndex().ToUnstableInt(); }
+
+		static uint32 EmitKey(const FName& Key)
+		{
+			const uint32 KeyId = GetKeyId(Key);
+			if (UE_TRACE_CHANNELEXPR_IS_ENABLED(GMPChannel))
+			{
+				bool bAlreadyEmitted = false;
+				EmittedKeys.Add(Key, &bAlreadyEmitted);
+				if (!bAlreadyEmitted)
+				{
+					const FString KeyStr = Key.ToString();
+					UE_TRACE_LOG(GMP, MessageKey, GMPChannel)
+						<< MessageKey.KeyId(KeyId)
+						<< MessageKey.Name(*KeyStr, KeyStr.Len());
+				}
+			}
+			return KeyId;
+		}
+
+		static ESourceKind GetSourceKind(const FSigSource& InSigSrc)
+		{
+			if (!InSigSrc.IsValid())
+				return ESourceKind::None;
+			if (InSigSrc == FSigSource::AnySigSrc)
+				return ESourceKind::Any;
+			if (InSigSrc.IsUObject())
+				return ESourceKind::Object;
+			if (InSigSrc.IsSigInc())
+				return ESourceKind::Signal;
+			if (InSigSrc.IsExternal())
+				return ESourceKind::External;
+			return ESourceKind::ExtKey;
+		}
+
+		// sum of the parameter element sizes, resolved once per key from the registered type names
+		static uint32 GetPayloadBytes(const FName& Key, int32 NumParams, const FName* TypeNames)
+		{
+			if (auto Find = PayloadBytesCache.Find(Key))
+				return *Find;
+			if (!TypeNames)
+				return 0;
+
+			uint32 Bytes = 0;
+			for (int32 i = 0; i < NumParams; ++i)
+			{
+				if (auto Prop = Class2Prop::FindOrAddProperty(TypeNames[i], nullptr))
+					Bytes += Prop->ElementSize;
+				else
+					Bytes += sizeof(void*);
+			}
+			PayloadBytesCache.Add(Key, Bytes);
+			return Bytes;
+		}
+	}  // namespace Details
+
+	void FSendScope::Begin(const FName& Key, const FSigSource& InSigSrc, int32 NumParams, const FName* TypeNames)
+	{
+		MessageKey = Key;
+		ParamCount = static_cast<uint16>(NumParams);
+		PayloadBytes = Details::GetPayloadBytes(Key, NumParams, TypeNames);
+		SourceKind = Details::GetSourceKind(InSigSrc);
+		Outer = Details::CurrentSend;
+		Details::CurrentSend = this;
+		++Details::SendDepth;
+		StartCycle = FPlatformTime::Cycles64();
+	}
+
+	void FSendScope::End()
+	{
+		const uint64 EndCycle = FPlatformTime::Cycles64();
+		Details::CurrentSend = Outer;
+		--Details::SendDepth;
+
+		const uint32 KeyId = Details::EmitKey(MessageKey);
+		UE_TRACE_LOG(GMP, Send, GMPChannel)
+			<< Send.StartCycle(StartCycle)
+			<< Send.EndCycle(EndCycle)
+			<< Send.KeyId(KeyId)
+			<< Send.ListenerCount(ListenerCount)
+			<< Send.PayloadBytes(PayloadBytes)
+			<< Send.ParamCount(ParamCount)
+			<< Send.SourceKind(static_cast<uint8>(SourceKind))
+			<< Send.Depth(Details::SendDepth);
+
+		if (GGMPTraceStats)
+		{
+			const uint64 Cycles = EndCycle - StartCycle;
+			auto& Stats = Details::KeyStats.FindOrAdd(MessageKey);
+			Stats.Key = MessageKey;
+			++Stats.Sends;
+			Stats.Listeners += ListenerCount;
+			Stats.Cycles += Cycles;
+			Stats.MaxCycles = FMath::Max(Stats.MaxCycles, Cycles);
+			Stats.PayloadBytes += PayloadBytes;
+		}
+	}
+
+	void FListenerScope::Begin(const FName& StoreKey, const FSigElm* Elem)
+	{
+		SigElm = Elem;
+		MessageKey = StoreKey;
+		if (auto Send = Details::CurrentSend)
+		{
+			++Send->ListenerCount;
+			if (MessageKey.IsNone())
+				MessageKey = Send->MessageKey;
+		}
+		StartCycle = FPlatformTime::Cycles64();
+	}
+
+	void FListenerScope::End()
+	{
+		const uint64 EndCycle = FPlatformTime::Cycles64();
+		// erasing is deferred until the fire loop ends, the element outlives its own callback
+		const uint64 HandlerId = static_cast<uint64>(static_cast<int64>(SigElm->GetGMPKey()));
+
+		const uint32 KeyId = Details::EmitKey(MessageKey);
+		UE_TRACE_LOG(GMP, Listener, GMPChannel)
+			<< Listener.StartCycle(StartCycle)
+			<< Listener.EndCycle(EndCycle)
+			<< Listener.HandlerId(HandlerId)
+			<< Listener.KeyId(KeyId);
+
+		if (GGMPTraceStats)
+		{
+			const uint64 Cycles = EndCycle - StartCycle;
+			auto& Stats = Details::ListenerStats.FindOrAdd(HandlerId);
+			if (!Stats.Calls)
+			{
+				Stats.Key = MessageKey;
+				Stats.HandlerId = HandlerId;
+				Stats.Handler = GetNameSafe(SigElm->GetHandler().Get());
+			}
+			++Stats.Calls;
+			Stats.Cycles += Cycles;
+			Stats.MaxCycles = FMath::Max(Stats.MaxCycles, Cycles);
+		}
+	}
+
+	void GetKeyStats(TArray<FKeyStats>& Out)
+	{
+		Details::KeyStats.GenerateValueArray(Out);
+		Out.Sort([](const FKeyStats& Lhs, const FKeyStats& Rhs) { return Lhs.Cycles > Rhs.Cycles; });
+	}
+
+	void GetListenerStats(TArray<FListenerStats>& Out)
+	{
+		Details::ListenerStats.GenerateValueArray(Out);
+		Out.Sort([](const FListenerStats& Lhs, const FListenerStats& Rhs) { return Lhs.Cycles > Rhs.Cycles; });
+	}
+
+	void ResetStats()
+	{
+		Details::KeyStats.Empty();
+		Details::ListenerStats.Empty();
+	}
+
+	static void DumpStats(int32 Count)
+	{
+		if (Count <= 0)
+			Count = 20;
+
+		TArray<FKeyStats> Keys;
+		GetKeyStats(Keys);
+		UE_LOG(LogGMP, Display, TEXT("GMP hot keys (%d of %d), inclusive time:"), FMath::Min(Count, Keys.Num()), Keys.Num());
+		for (int32 i = 0; i < Keys.Num() && i < Count; ++i)
+		{
+			auto& Stats = Keys[i];
+			UE_LOG(LogGMP,
+				   Display,
+				   TEXT("  %-48s sends:%8llu total:%9.3fms avg:%7.3fus max:%8.3fus listeners/send:%6.2f bytes/send:%llu"),
+				   *Stats.Key.ToString(),
+				   Stats.Sends,
+				   FPlatformTime::ToMilliseconds64(Stats.Cycles),
+				   FPlatformTime::ToMilliseconds64(Stats.Cycles) * 1000.0 / Stats.Sends,
+				   FPlatformTime::ToMilliseconds64(Stats.MaxCycles) * 1000.0,
+				   double(Stats.Listeners) / Stats.Sends,
+				   Stats.PayloadBytes / Stats.Sends);
+		}
+
+		TArray<FListenerStats> Listeners;
+		GetListenerStats(Listeners);
+		UE_LOG(LogGMP, Display, TEXT("GMP slow listeners (%d of %d):"), FMath::Min(Count, Listeners.Num()), Listeners.Num());
+		for (int32 i = 0; i < Listeners.Num() && i < Count; ++i)
+		{
+			auto& Stats = Listeners[i];
+			UE_LOG(LogGMP,
+				   Display,
+				   TEXT("  %-48s [%llu] %-32s calls:%8llu total:%9.3fms avg:%7.3fus max:%8.3fus"),
+				   *Stats.Key.ToString(),
+				   Stats.HandlerId,
+				   *Stats.Handler,
+				   Stats.Calls,
+				   FPlatformTime::ToMilliseconds64(Stats.Cycles),
+				   FPlatformTime::ToMilliseconds64(Stats.Cycles) * 1000.0 / Stats.Calls,
+				   FPlatformTime::ToMilliseconds64(Stats.MaxCycles) * 1000.0);
+		}
+	}
+
+	FXConsoleCommandLambda XVar_GMPTraceDump(TEXT("gmp.trace.dump"), [](int32 InCount, UWorld* InWorld) { DumpStats(InCount); });
+	FXConsoleCommandLambda XVar_GMPTraceReset(TEXT("gmp.trace.reset"), [](UWorld* InWorld) { ResetStats(); });
+}  // namespace Trace
+}  // namespace GMP
+#endif  // GMP_WITH_TRACE_CHANNEL
@@ -16,6 +16,8 @@
 #include "Net/Core/PushModel/PushModel.h"
 #endif
 #include "GMPRpcProxy.h"
+#include "UObject/ObjectKey.h"
+#include "XConsoleManager.h"
 
 #if WITH_EDITOR
 namespace GMP
@@ -336,41 +338,114 @@ namespace Class2Prop
 }
 }  // namespace GMP
 
-UScriptStruct* FGMPStructUnion::MakeRuntimeStruct(FName MsgKey, const FGMPPropStackRefArray& Arr, bool bStore)
+namespace GMP
 {
-	int32 Cnt = -1;
-	static auto GetPropCnt = [](const UStruct* InStruct) {
-		int32 Cnt = 0;
-		for (TFieldIterator<FProperty> It(InStruct); It; ++It)
+namespace RuntimeStructCache
+{
+	// Runtime message structs are shared by parameter signature: re-storing a key, or another key with the same
+	// parameter types, reuses the struct (and its param offsets) instead of building a new one.
+	struct FEntry
+	{
+		TWeakObjectPtr<UScriptStruct> Struct;
+		// the struct's own properties, in parameter order
+		TArray<const FProperty*> Props;
+		bool bStore = false;
+	};
+	static TMap<uint32, TArray<FEntry, TInlineAllocator<1>>> Entries;
+
+	static uint32 HashPropType(const FProperty* Prop)
+	{
+		uint32 Hash = HashCombine(GetTypeHash(Prop->GetClass()), GetTypeHash(GMP::GetElementSize(Prop)));
+		if (auto StructProp = CastField<FStructProperty>(Prop))
+			Hash = HashCombine(Hash, GetTypeHash(StructProp->Struct));
+		else if (auto ObjProp = CastField<FObjectPropertyBase>(Prop))
+			Hash = HashCombine(Hash, GetTypeHash(ObjProp->PropertyClass));
+		else if (auto EnumProp = CastField<FEnumProperty>(Prop))
+			Hash = HashCombine(Hash, GetTypeHash(EnumProp->GetEnum()));
+		else if (auto ByteProp = CastField<FByteProperty>(Prop))
+			Hash = HashCombine(Hash, GetTypeHash(ByteProp->Enum));
+		else if (auto ArrProp = CastField<FArrayProperty>(Prop))
+			Hash = HashCombine(Hash, HashPropType(ArrProp->Inner));
+		else if (auto SetProp = CastField<FSetProperty>(Prop))
+			Hash = HashCombine(Hash, HashPropType(SetProp->ElementProp));
+		else if (auto MapProp = CastField<FMapProperty>(Prop))
+			Hash = HashCombine(HashCombine(Hash, HashPropType(MapProp->KeyProp)), HashPropType(MapProp->ValueProp));
+		return Hash;
+	}
+
+	static bool IsSameSignature(const FEntry& Entry, const FGMPPropStackRefArray& Arr)
+	{
+		if (Entry.Props.Num() != Arr.Num())
+			return false;
+		for (int32 Idx = 0; Idx < Arr.Num(); ++Idx)
 		{
-			++Cnt;
+			if (!Entry.Props[Idx]->SameType(Arr[Idx].GetProp()))
+				return false;
 		}
-		return Cnt;
-	};
+		return true;
+	}
+
+	static void RegisterStruct(UGMPPropertiesContainer* Holder, UScriptStruct* Struct, const FEntry& Entry)
+	{
+		Holder->AddScriptStruct(Struct->GetFName(), Struct);
+#if GMP_WITH_DIRECT_SIGNAL && !GMP_SCRIPTSTRUCT
+		// Path B (GMP_SCRIPTSTRUCT=0): cache typed-StoreMessage param offsets by struct name (what GetMessageParamOffsets
+		// looks up through the union type name), same lifetime as the cached struct.
+		TArray<int32> Offs;
+		Offs.Reserve(Entry.Props.Num());
+		for (const FProperty* Prop : Entry.Props)
+			Offs.Add(Prop->GetOffset_ForInternal());
+		Holder->AddParamOffsets(Struct->GetFName(), MoveTemp(Offs));
+#endif
+	}
+}  // namespace RuntimeStructCache
+}  // namespace GMP
+
+UScriptStruct* FGMPStructUnion::MakeRuntimeStruct(FName MsgKey, const FGMPPropStackRefArray& Arr, bool bStore)
+{
+	using namespace GMP::RuntimeStructCache;
 	const auto RuntimeStructFlagVal = 0x80000000;
 	const EStructFlags RuntimeStructFlag = static_cast<EStructFlags>(RuntimeStructFlagVal);
+
+	uint32 Hash = GetTypeHash(bStore);
+	for (auto& Ref : Arr)
+		Hash = HashCombine(Hash, HashPropType(Ref.GetProp()));
+
 	auto Holder = GMP::Class2Prop::GMPGetMessagePropertiesHolder();
-	UScriptStruct* RetScript = Holder->FindScriptStructByName(MsgKey);
-	if (!RetScript || GetPropCnt(RetScript) <= Arr.Num())
+	auto& Bucket = Entries.FindOrAdd(Hash);
+	for (int32 Idx = Bucket.Num() - 1; Idx >= 0; --Idx)
 	{
-		RetScript = GMP::Class2Prop::MakeRuntimeStruct(Holder, MsgKey, [&]() -> const FProperty* { return Arr.IsValidIndex(++Cnt) ? Arr[Cnt].GetProp() : nullptr; });
-		Holder->AddScriptStruct(MsgKey, RetScript);
-#if GMP_WITH_DIRECT_SIGNAL && !GMP_SCRIPTSTRUCT
-		// Path B (GMP_SCRIPTSTRUCT=0): cache typed-StoreMessage param offsets by key, same lifetime as the cached struct.
-		// Same param-order TFieldIterator walk as Path A; kept adjacent to AddScriptStruct so the two never drift.
+		// the holder drops its structs at PIE end, collected ones are pruned here and surviving ones re-registered
+		UScriptStruct* Cached = Bucket[Idx].Struct.Get();
+		if (!Cached)
 		{
-			TArray<int32> Offs;
-			Offs.Reserve(Arr.Num());
-			for (TFieldIterator<FProperty> It(RetScript); It; ++It)
-				Offs.Add(It->GetOffset_ForInternal());
-			Holder->AddParamOffsets(MsgKey, MoveTemp(Offs));
+			Bucket.RemoveAtSwap(Idx);
 		}
-#endif
-		if (bStore)
+		else if (Bucket[Idx].bStore == bStore && IsSameSignature(Bucket[Idx], Arr))
 		{
-			(std::underlying_type_t<EStructFlags>&)(RetScript->StructFlags) |= RuntimeStructFlag;
+			if (Holder->FindScriptStructByName(Cached->GetFName()) != Cached)
+				RegisterStruct(Holder, Cached, Bucket[Idx]);
+			return Cached;
 		}
 	}
+
+	int32 Cnt = -1;
+	// named after the first key that needed the signature, unique as structs from a cleared holder may still be alive
+	const FName StructName = MakeUniqueObjectName(Holder, UScriptStruct::StaticClass(), MsgKey);
+	UScriptStruct* RetScript = GMP::Class2Prop::MakeRuntimeStruct(Holder, StructName, [&]() -> const FProperty* { return Arr.IsValidIndex(++Cnt) ? Arr[Cnt].GetProp() : nullptr; });
+
+	FEntry& Entry = Bucket.AddDefaulted_GetRef();
+	Entry.Struct = RetScript;
+	Entry.bStore = bStore;
+	Entry.Props.Reserve(Arr.Num());
+	for (TFieldIterator<FProperty> It(RetScript); It; ++It)
+		Entry.Props.Add(*It);
+	RegisterStruct(Holder, RetScript, Entry);
+
+	if (bStore)
+	{
+		(std::underlying_type_t<EStructFlags>&)(RetScript->StructFlags) |= RuntimeStructFlag;
+	}
 #if WITH_EDITOR
 	auto Val = bStore ? RuntimeStructFlagVal : 0u;
 	auto StructFlags = std::underlying_type_t<EStructFlags>(RetScript->StructFlags);
@@ -484,11 +559,271 @@ bool FGMPStructUnion::Serialize(FStructuredArchive::FRecord Record)
 	return true;
 }
 
+namespace GMP
+{
+namespace UnionNet
+{
+	static int32 GUnionNetDelta = 0;
+	static FXConsoleVariableRef CVarUnionNetDelta(TEXT("gmp.net.UnionDelta"), GUnionNetDelta, TEXT("Delta encode FGMPStructUnion in reliable GMP rpc payloads against a per-connection shadow (0=off, 1=on)"));
+
+	// net serialization is game thread only
+	static UPackageMap* GDeltaMap = nullptr;
+	static const uint32 MaxNetStructIndex = 0xFFFF;
+
+	struct FStructState
+	{
+		TWeakObjectPtr<const UScriptStruct> Struct;
+		const FField* LayoutHead = nullptr;
+		// empty for structs with a native net serializer, those are always sent whole
+		TArray<FProperty*> NetProps;
+		// last value sent (or received) for this struct type
+		FGMPStructUnion Baseline;
+
+		void Init(const UScriptStruct* InStruct)
+		{
+			Struct = InStruct;
+			LayoutHead = InStruct->ChildProperties;
+			NetProps.Reset();
+			Baseline = FGMPStructUnion();
+			if (!(InStruct->StructFlags & STRUCT_NetSerializeNative))
+			{
+				for (TFieldIterator<FProperty> It(InStruct); It; ++It)
+				{
+					if (!It->HasAnyPropertyFlags(CPF_RepSkip))
+						NetProps.Add(*It);
+				}
+			}
+		}
+		bool IsUpToDate(const UScriptStruct* InStruct) const { return Struct.Get() == InStruct && LayoutHead == InStruct->ChildProperties; }
+	};
+
+	struct FConnectionShadow
+	{
+		// states are heap allocated, unions nested in a union's fields re-enter while an outer state is in use
+		TMap<const UScriptStruct*, int32> SentIndices;
+		TArray<TUniquePtr<FStructState>> Sent;
+		TArray<TUniquePtr<FStructState>> Received;
+		// nesting level of NetSerializeDelta, states may only be dropped once the outermost union is done
+		int32 Depth = 0;
+	};
+	static TMap<FObjectKey, TUniquePtr<FConnectionShadow>> Shadows;
+
+	static FConnectionShadow& FindOrAddShadow(UPackageMap* Map)
+	{
+		static FDelegateHandle PurgeHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddLambda([] {
+			for (auto It = Shadows.CreateIterator(); It; ++It)
+			{
+				if (!It->Key.ResolveObjectPtr())
+					It.RemoveCurrent();
+			}
+		});
+
+		auto& Shadow = Shadows.FindOrAdd(FObjectKey(Map));
+		if (!Shadow)
+			Shadow = MakeUnique<FConnectionShadow>();
+		return *Shadow;
+	}
+
+	static bool IsFieldChanged(const FProperty* Prop, const void* Addr, const void* BaseAddr)
+	{
+		for (int32 Idx = 0; Idx < Prop->ArrayDim; ++Idx)
+		{
+			if (!Prop->Identical_InContainer(Addr, BaseAddr, Idx))
+				return true;
+		}
+		return false;
+	}
+
+	static bool SerializeField(FArchive& Ar, UPackageMap* Map, FProperty* Prop, void* Addr)
+	{
+		bool bSucc = true;
+		for (int32 Idx = 0; Idx < Prop->ArrayDim; ++Idx)
+			bSucc &= Prop->NetSerializeItem(Ar, Map, Prop->ContainerPtrToValuePtr<void>(Addr, Idx));
+		return bSucc;
+	}
+}  // namespace UnionNet
+
+FUnionNetDeltaScope::FUnionNetDeltaScope(UPackageMap* InMap, bool bEnable)
+	: PrevMap(UnionNet::GDeltaMap)
+{
+	UnionNet::GDeltaMap = (bEnable && UnionNet::GUnionNetDelta) ? InMap : nullptr;
+}
+
+FUnionNetDeltaScope::~FUnionNetDeltaScope()
+{
+	UnionNet::GDeltaMap = PrevMap;
+}
+
+void ResetUnionNetShadow(UPackageMap* InMap)
+{
+	if (auto Find = UnionNet::Shadows.Find(FObjectKey(InMap)))
+	{
+		(*Find)->SentIndices.Empty();
+		(*Find)->Sent.Empty();
+	}
+}
+
+void ResetUnionNetReceiveShadow(UPackageMap* InMap)
+{
+	if (auto Find = UnionNet::Shadows.Find(FObjectKey(InMap)))
+		(*Find)->Received.Empty();
+}
+
+bool IsUnionNetDeltaEnabled()
+{
+	return !!UnionNet::GUnionNetDelta;
+}
+}  // namespace GMP
+
+bool FGMPStructUnion::NetSerializeDelta(FArchive& Ar, UPackageMap* Map, int32 InArrNum)
+{
+	using namespace GMP::UnionNet;
+	if (!Map || InArrNum <= 0)
+	{
+		Ar.SetError();
+		return false;
+	}
+
+	FConnectionShadow& Shadow = FindOrAddShadow(Map);
+	++Shadow.Depth;
+	ON_SCOPE_EXIT
+	{
+		--Shadow.Depth;
+	};
+	uint32 StructIndex = 0;
+	uint8 bWithRef = 0;
+	FStructState* State = nullptr;
+	if (Ar.IsSaving())
+	{
+		auto StructType = ScriptStruct.Get();
+		int32& Index = Shadow.SentIndices.FindOrAdd(StructType, INDEX_NONE);
+		if (Index == INDEX_NONE)
+			Index = Shadow.Sent.Add(MakeUnique<FStructState>());
+		State = Shadow.Sent[Index].Get();
+		if (!State->IsUpToDate(StructType))
+		{
+			State->Init(StructType);
+			bWithRef = 1;
+		}
+
+		StructIndex = Index;
+		Ar.SerializeIntPacked(StructIndex);
+		Ar.SerializeBits(&bWithRef, 1);
+		if (bWithRef)
+		{
+			UObject* StructObj = const_cast<UScriptStruct*>(StructType);
+			Ar << StructObj;
+		}
+	}
+	else
+	{
+		Ar.SerializeIntPacked(StructIndex);
+		Ar.SerializeBits(&bWithRef, 1);
+		if (StructIndex > MaxNetStructIndex)
+		{
+			Ar.SetError();
+			return false;
+		}
+		if (bWithRef)
+		{
+			UObject* StructObj = nullptr;
+			Ar << StructObj;
+			auto StructType = Cast<UScriptStruct>(StructObj);
+			if (!StructType)
+			{
+				// the element payload can not be skipped without its layout
+				Reset();
+				Ar.SetError();
+				return false;
+			}
+			if (Shadow.Received.Num() <= static_cast<int32>(StructIndex))
+				Shadow.Received.SetNum(StructIndex + 1);
+			if (!Shadow.Received[StructIndex])
+				Shadow.Received[StructIndex] = MakeUnique<FStructState>();
+			Shadow.Received[StructIndex]->Init(StructType);
+		}
+		State = Shadow.Received.IsValidIndex(StructIndex) ? Shadow.Received[StructIndex].Get() : nullptr;
+		if (!State || !State->Struct.IsValid())
+		{
+			Ar.SetError();
+			return false;
+		}
+		EnsureMemory(State->Struct.Get(), InArrNum, true);
+	}
+
+	auto StructType = const_cast<UScriptStruct*>(State->Struct.Get());
+	auto StructProp = GMP::Class2Prop::TTraitsStructBase::GetProperty(StructType);
+	const int32 BaseNum = State->Baseline.GetType() == StructType ? State->Baseline.GetArrayNum() : 0;
+	bool bSucc = true;
+	for (auto i = 0; i < InArrNum && bSucc; ++i)
+	{
+		uint8* ElemAddr = GetDynData(i);
+		uint8 bDeltaElem = State->NetProps.Num() > 0 && i < BaseNum;
+		Ar.SerializeBits(&bDeltaElem, 1);
+		if (!bDeltaElem)
+		{
+			bSucc &= StructProp->NetSerializeItem(Ar, Map, ElemAddr);
+			continue;
+		}
+		if (State->NetProps.Num() == 0 || i >= BaseNum)
+		{
+			bSucc = false;
+			break;
+		}
+
+		const uint8* BaseAddr = State->Baseline.GetDynData(i);
+		if (Ar.IsLoading())
+			StructType->CopyScriptStruct(ElemAddr, BaseAddr);
+		for (FProperty* Prop : State->NetProps)
+		{
+			uint8 bChanged = Ar.IsSaving() && IsFieldChanged(Prop, ElemAddr, BaseAddr);
+			Ar.SerializeBits(&bChanged, 1);
+			if (bChanged && !SerializeField(Ar, Map, Prop, ElemAddr))
+			{
+				bSucc = false;
+				break;
+			}
+		}
+	}
+
+	if (!bSucc || Ar.IsError())
+	{
+		Ar.SetError();
+		// a nested union fails its outer one as well, which drops the shadow once no state is in use
+		if (Shadow.Depth == 1)
+		{
+			if (Ar.IsSaving())
+				GMP::ResetUnionNetShadow(Map);
+			else
+				GMP::ResetUnionNetReceiveShadow(Map);
+		}
+		return false;
+	}
+	// the baseline only feeds field deltas, native net serialized structs are always sent whole
+	if (GUnionNetDelta && State->NetProps.Num() > 0)
+		State->Baseline = Duplicate();
+	return true;
+}
+
 bool FGMPStructUnion::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
 {
 	int32 TmpArrNum = GetArrayNum();
+	if (Ar.IsSaving() && TmpArrNum > 0 && Map && Map == GMP::UnionNet::GDeltaMap && ScriptStruct.IsValid())
+	{
+		// a negative count marks the delta encoding
+		int32 EncodedNum = -TmpArrNum;
+		Ar << EncodedNum;
+		bOutSuccess = NetSerializeDelta(Ar, Map, TmpArrNum);
+		return true;
+	}
+
 	Ar << TmpArrNum;
-	if (TmpArrNum > 0)
+	if (TmpArrNum < 0)
+	{
+		bOutSuccess = Ar.IsLoading() && TmpArrNum != MIN_int32 && NetSerializeDelta(Ar, Map, -TmpArrNum);
+		return true;
+	}
+	else if (TmpArrNum > 0)
 	{
 		Ar << ScriptStruct;
 		auto StructType = const_cast<UScriptStruct*>(ScriptStruct.Get());
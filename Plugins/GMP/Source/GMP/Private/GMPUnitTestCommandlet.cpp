@@ -7,6 +7,10 @@
 // The actual tests live in GMPTests.cpp (UE automation framework). This commandlet only
 // forwards to GMPUnitTest::RunAllGMPTests(), which the automation framework does not cover
 // (it has no headless single-exit-code runner). See GMPTests.cpp for the test bodies.
+//
+// GMPBenchmark commandlet -- parametrized dispatch benchmarks with JSON output:
+//   <Editor>-Cmd.exe <Project> -run=GMPBenchmark [-Suite=Dispatch] [-Listeners=1,8,64] [-Json=<path>]
+// See GMPBenchmarks.cpp for the scenarios and every option.
 
 #include "GMPUnitTestCommandlet.h"
 
@@ -14,3 +18,8 @@ int32 UGMPUnitTestCommandlet::Main(const FString& Params)
 {
 	return GMPUnitTest::RunAllGMPTests(Params);
 }
+
+int32 UGMPBenchmarkCommandlet::Main(const FString& Params)
+{
+	return GMPUnitTest::RunGMPBenchmarks(Params);
+}
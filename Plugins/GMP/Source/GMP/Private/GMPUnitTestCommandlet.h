@@ -8,6 +8,7 @@
 #include "CoreMinimal.h"
 #include "Commandlets/Commandlet.h"
 #include "Engine/World.h"
+#include "UObject/CoreNet.h"
 #include "UObject/Interface.h"
 
 #include "GMPUnitTestCommandlet.generated.h"
@@ -17,6 +18,8 @@
 namespace GMPUnitTest
 {
 	int32 RunAllGMPTests(const FString& Params);
+	// Benchmark suites (GMPBenchmarks.cpp), returns nonzero when a suite could not report
+	int32 RunGMPBenchmarks(const FString& Params);
 }
 
 UCLASS()
@@ -27,6 +30,14 @@ public:
 	virtual int32 Main(const FString& Params) override;
 };
 
+UCLASS()
+class UGMPBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+public:
+	virtual int32 Main(const FString& Params) override;
+};
+
 // A concrete, throwaway UObject used as a message source / listener holder (no world needed).
 // MUST be concrete: NewObject<UObject>() on the abstract UObject base trips a handled ensure
 // ("Class which was marked abstract was trying to be loaded"), which UE Automation treats as a
@@ -72,12 +83,37 @@ public:
 		return FString(TEXT("R:")) + In; // non-POD return value
 	}
 
+	// Same shape as FastCallScaleOut, flagged FUNC_UbergraphFunction by the listener frame test so
+	// CallMessageFunction takes its parameter block + frame copy route.
+	UFUNCTION()
+	void UbergraphScaleOut(int32 In, UPARAM(ref) int32& OutDouble)
+	{
+		LastA = In;
+		OutDouble = In * 2;
+	}
+
 	int32 LastA = 0;
 	int32 LastB = 0;
 	int32 TickCount = 0;
 	FString LastStr;
 };
 
+// Resolves objects by path name so net serialization round trips without a connection.
+UCLASS(transient)
+class UGMPTestPackageMap : public UPackageMap
+{
+	GENERATED_BODY()
+public:
+	virtual bool SerializeObject(FArchive& Ar, UClass* InClass, UObject*& Obj, FNetworkGUID* OutNetGUID = nullptr) override
+	{
+		FString Path = (Ar.IsSaving() && Obj) ? Obj->GetPathName() : FString();
+		Ar << Path;
+		if (Ar.IsLoading())
+			Obj = Path.IsEmpty() ? nullptr : StaticFindObject(InClass, nullptr, *Path);
+		return true;
+	}
+};
+
 // Probe whose source object has a real world source for leveled dispatch tests.
 UCLASS()
 class UGMPWorldProbe : public UGMPTestProbe
@@ -114,3 +150,152 @@ class UGMPTestInterfaceImpl : public UObject, public IGMPTestInterface
 public:
 	virtual int32 GMPTestMagic() const override { return 4242; }
 };
+
+// ---- serializer benchmark fixtures (GMPBenchmarks.cpp, -run=GMPBenchmark -Suite=Serializer) ----
+// Filled programmatically by the suite (-Elements=N scales every container), the shapes stress different codec paths:
+// many scalar fields, nested structs, large arrays and maps.
+USTRUCT()
+struct FGMPBenchWide
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	bool bFlag0 = false;
+	UPROPERTY()
+	bool bFlag1 = false;
+	UPROPERTY()
+	int32 Int0 = 0;
+	UPROPERTY()
+	int32 Int1 = 0;
+	UPROPERTY()
+	int32 Int2 = 0;
+	UPROPERTY()
+	int32 Int3 = 0;
+	UPROPERTY()
+	int32 Int4 = 0;
+	UPROPERTY()
+	int32 Int5 = 0;
+	UPROPERTY()
+	int32 Int6 = 0;
+	UPROPERTY()
+	int32 Int7 = 0;
+	UPROPERTY()
+	int64 Big0 = 0;
+	UPROPERTY()
+	int64 Big1 = 0;
+	UPROPERTY()
+	int64 Big2 = 0;
+	UPROPERTY()
+	int64 Big3 = 0;
+	UPROPERTY()
+	float Float0 = 0.f;
+	UPROPERTY()
+	float Float1 = 0.f;
+	UPROPERTY()
+	float Float2 = 0.f;
+	UPROPERTY()
+	float Float3 = 0.f;
+	UPROPERTY()
+	double Double0 = 0.0;
+	UPROPERTY()
+	double Double1 = 0.0;
+	UPROPERTY()
+	FString Str0;
+	UPROPERTY()
+	FString Str1;
+	UPROPERTY()
+	FString Str2;
+	UPROPERTY()
+	FString Str3;
+	UPROPERTY()
+	FName Name0;
+	UPROPERTY()
+	FName Name1;
+	UPROPERTY()
+	FVector Vec0 = FVector::ZeroVector;
+	UPROPERTY()
+	FVector Vec1 = FVector::ZeroVector;
+};
+
+USTRUCT()
+struct FGMPBenchLeaf
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 Id = 0;
+	UPROPERTY()
+	float Weight = 0.f;
+	UPROPERTY()
+	FString Label;
+	UPROPERTY()
+	FVector Pos = FVector::ZeroVector;
+};
+
+USTRUCT()
+struct FGMPBenchBranch
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FGMPBenchLeaf Head;
+	UPROPERTY()
+	TArray<FGMPBenchLeaf> Leaves;
+};
+
+USTRUCT()
+struct FGMPBenchNested
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FGMPBenchWide Header;
+	UPROPERTY()
+	TArray<FGMPBenchBranch> Branches;
+};
+
+USTRUCT()
+struct FGMPBenchArrays
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<uint8> Bytes;
+	UPROPERTY()
+	TArray<int32> Ints;
+	UPROPERTY()
+	TArray<float> Floats;
+	UPROPERTY()
+	TArray<FString> Strings;
+	UPROPERTY()
+	TArray<FVector> Vectors;
+	UPROPERTY()
+	TArray<FGMPBenchLeaf> Leaves;
+};
+
+USTRUCT()
+struct FGMPBenchMaps
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TMap<int32, int32> IntToInt;
+	UPROPERTY()
+	TMap<FString, int32> StrToInt;
+	UPROPERTY()
+	TMap<FName, FVector> NameToVec;
+	UPROPERTY()
+	TMap<int32, FGMPBenchLeaf> IntToLeaf;
+};
+
+// Member chain target (UGMPBPLib::CopyMemberByChainName): a struct run (Branch.Head.Id) and an object hop (Next.Branch...).
+UCLASS()
+class UGMPTestChainHolder : public UObject
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FGMPBenchBranch Branch;
+	UPROPERTY()
+	UGMPTestChainHolder* Next = nullptr;
+};
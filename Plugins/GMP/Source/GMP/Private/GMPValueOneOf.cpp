@@ -6,6 +6,31 @@
 #include "GMPProtoUtils.h"
 #include "GMPJsonSerializer.h"
 #include "GMPProtoSerializer.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/PlatformFileManager.h"
+
+namespace GMP
+{
+namespace OneOf
+{
+	struct FMappedFile
+	{
+		TUniquePtr<IMappedFileHandle> Handle;
+		TUniquePtr<IMappedFileRegion> Region;
+
+		bool Open(const TCHAR* Filename)
+		{
+			Handle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(Filename));
+			// views below are int32 sized
+			if (!Handle || Handle->GetFileSize() <= 0 || Handle->GetFileSize() > MAX_int32)
+				return false;
+			Region.Reset(Handle->MapRegion(0, Handle->GetFileSize()));
+			return Region.IsValid();
+		}
+		TArrayView<const uint8> GetView() const { return TArrayView<const uint8>(Region->GetMappedPtr(), static_cast<int32>(Region->GetMappedSize())); }
+	};
+}  // namespace OneOf
+}  // namespace GMP
 
 int32 FGMPValueOneOf::IterateKeyValueImpl(int32 Idx, FString& OutKey, FGMPValueOneOf& OutValue, bool bBinary) const
 {
@@ -19,8 +44,25 @@ int32 FGMPValueOneOf::IterateKeyValueImpl(int32 Idx, FString& OutKey, FGMPValueO
 	}
 }
 
-bool FGMPValueOneOf::LoadFromFile(const FString& FilePath, bool bBinary /*=false*/)
+bool FGMPValueOneOf::LoadFromFile(const FString& FilePath, bool bBinary /*=false*/, bool bMapped /*=false*/)
 {
+	GMP::OneOf::FMappedFile Mapped;
+	if (bMapped && Mapped.Open(*FilePath))
+	{
+		// the region is released on return, the parsed document owns everything it needs
+		TArrayView<const uint8> View = Mapped.GetView();
+		if (!bBinary)
+		{
+			// non utf8 content goes through the archive reader which detects the encoding
+			if (GMP::Json::OneOfFromJsonImpl(View, *this))
+				return true;
+		}
+		else
+		{
+			return GMP::Proto::UStructFromProto(TConstArrayView<uint8>(View), *this);
+		}
+	}
+
 	if (!bBinary)
 	{
 		return GMP::Json::UStructFromJsonFile(*FilePath, *this);
@@ -55,28 +97,50 @@ bool FGMPValueOneOf::AsValueImpl(FProperty* Prop, void* Out, FName SubKey, bool
 bool FGMPValueOneOf::AsValueImpl(FProperty* ResultProp, void* Out, TConstArrayView<FName> SubKeys, bool bBinary) const
 {
 	check(SubKeys.Num());
-	FGMPValueOneOf Val = *this;
-	static auto OneOfProp = GMP::TClass2Prop<FGMPValueOneOf>::GetProperty();
+	return AsValueImpl(ResultProp, Out, FGMPValuePath(SubKeys), bBinary);
+}
+
+bool FGMPValueOneOf::AsValueImpl(FProperty* ResultProp, void* Out, const FGMPValuePath& Path, bool bBinary) const
+{
 	if (!bBinary)
 	{
-		for (auto i = 0; i < SubKeys.Num() - 1; ++i)
-		{
-			if (UGMPJsonUtils::AsValueImpl(Val, OneOfProp, &Val, SubKeys[i]))
-			{
-				return false;
-			}
-		}
-		return UGMPJsonUtils::AsValueImpl(Val, ResultProp, Out, SubKeys.Last());
+		return UGMPJsonUtils::AsValueImpl(*this, ResultProp, Out, Path);
 	}
 	else
 	{
-		for (auto i = 0; i < SubKeys.Num() - 1; ++i)
+		return UGMPProtoUtils::AsValueImpl(*this, ResultProp, Out, Path);
+	}
+}
+
+FGMPValuePath::FGMPValuePath(TConstArrayView<FName> InKeys)
+{
+	Segments.Reserve(InKeys.Num());
+	for (FName Key : InKeys)
+		AddKey(Key);
+}
+
+FGMPValuePath::FGMPValuePath(const FStringView& InPath)
+{
+	int32 Start = 0;
+	for (int32 Idx = 0; Idx <= InPath.Len(); ++Idx)
+	{
+		if (Idx == InPath.Len() || InPath[Idx] == TEXT('/') || InPath[Idx] == TEXT('.'))
 		{
-			if (UGMPProtoUtils::AsValueImpl(Val, OneOfProp, &Val, SubKeys[i]))
-			{
-				return false;
-			}
+			if (Idx > Start)
+				AddKey(FName(Idx - Start, InPath.GetData() + Start));
+			Start = Idx + 1;
 		}
-		return UGMPProtoUtils::AsValueImpl(Val, ResultProp, Out, SubKeys.Last());
+	}
+}
+
+void FGMPValuePath::AddKey(FName InKey)
+{
+	FSegment& Segment = Segments.AddDefaulted_GetRef();
+	Segment.Key = InKey;
+	if (!InKey.IsNone())
+	{
+		Segment.Str = InKey.ToString();
+		FTCHARToUTF8 Utf8(*Segment.Str, Segment.Str.Len());
+		Segment.Utf8.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
 	}
 }
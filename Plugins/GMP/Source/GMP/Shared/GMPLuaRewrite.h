@@ -2,24 +2,42 @@
 
 #pragma once
 #include "CoreMinimal.h"
+#include "HAL/FileManager.h"
+#include "Hash/CityHash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 
 // Backend-agnostic load-time lua source rewriter, shared by the UnLua and slua GMP backends:
 //   NotifyObjectMessage(sender, "Tag", ...) -> Notify_<id>(sender, ...)
 // so script authors keep writing NotifyObjectMessage while each call reaches the per-tag key-baked SB (Notify_<id>).
 // Robust lexer: skips lua short/long strings and line/block comments. SanitizeInto mirrors GMPScriptCodeGen::SanitizeIdent
-// (non [0-9A-Za-z_] -> '_'). Pure text over FString; the function is stateless so slua's capture-less raw loadFileDelegate
-// can call it too.
+// (non [0-9A-Za-z_] -> '_'). The lexer walks FStringView slices and copies untouched runs in one append, chunks without any
+// NotifyObjectMessage are returned as is. RewriteToUtf8 additionally keeps the utf8 output in a content-hashed disk cache
+// (Saved/GMP/LuaRewrite), one entry per source file: writing the chunk of an edited file deletes the one it replaces.
+// Everything is stateless so slua's capture-less raw loadFileDelegate can call it too.
+#if !defined(GMP_LUA_REWRITE_CACHE)
+#define GMP_LUA_REWRITE_CACHE 1
+#endif
+
 namespace GMPLuaRewrite
 {
-inline void SanitizeInto(FString& Out, const FString& Key)
+// Bump whenever the rewritten output changes for the same input, it is part of the cache key.
+constexpr uint32 FormatVersion = 2;
+
+inline bool IsIdentChar(TCHAR C)
+{
+	return (C >= '0' && C <= '9') || (C >= 'A' && C <= 'Z') || (C >= 'a' && C <= 'z') || C == '_';
+}
+
+inline void SanitizeInto(FString& Out, FStringView Key)
 {
 	Out.Reserve(Out.Len() + Key.Len());
 	for (TCHAR C : Key)
-		Out.AppendChar(((C >= '0' && C <= '9') || (C >= 'A' && C <= 'Z') || (C >= 'a' && C <= 'z') || C == '_') ? C : TEXT('_'));
+		Out.AppendChar(IsIdentChar(C) ? C : TEXT('_'));
 }
 
 // [==[ ... ]==] level at S[i]=='['; returns eq-count and validity.
-inline bool LongBracketLevel(const FString& S, int32 i, int32& OutLevel)
+inline bool LongBracketLevel(FStringView S, int32 i, int32& OutLevel)
 {
 	const int32 N = S.Len();
 	if (i >= N || S[i] != '[')
@@ -30,45 +48,58 @@ inline bool LongBracketLevel(const FString& S, int32 i, int32& OutLevel)
 	return false;
 }
 
-inline int32 SkipLong(const FString& S, int32 from, int32 level)
+// index just after the ]==] closing a long bracket of the given level, searching from 'from'
+inline int32 SkipLong(FStringView S, int32 from, int32 level)
 {
-	FString Close = TEXT("]");
-	for (int32 e = 0; e < level; ++e) Close.AppendChar('=');
-	Close.AppendChar(']');
-	const int32 idx = S.Find(Close, ESearchCase::CaseSensitive, ESearchDir::FromStart, from);
-	return idx >= 0 ? idx + Close.Len() : S.Len();
+	const int32 N = S.Len();
+	for (int32 i = from; i < N; ++i)
+	{
+		if (S[i] != ']')
+			continue;
+		int32 k = i + 1;
+		while (k < N && k - i - 1 < level && S[k] == '=') ++k;
+		if (k - i - 1 == level && k < N && S[k] == ']')
+			return k + 1;
+	}
+	return N;
+}
+
+// index just after the short string opened by the quote at S[i]
+inline int32 SkipShort(FStringView S, int32 i)
+{
+	const int32 N = S.Len();
+	const TCHAR q = S[i];
+	int32 j = i + 1;
+	while (j < N) { if (S[j] == '\\') { j += 2; continue; } if (S[j] == q) { ++j; break; } ++j; }
+	return FMath::Min(j, N);
 }
 
-// Parse args of a call whose '(' is at OpenParen; fills top-level arg substrings, returns index just after ')'.
-inline bool SplitArgs(const FString& S, int32 OpenParen, TArray<FString>& OutArgs, int32& OutAfter)
+using FArgViews = TArray<FStringView, TInlineAllocator<8>>;
+
+// Parse args of a call whose '(' is at OpenParen; fills top-level arg slices, returns index just after ')'.
+inline bool SplitArgs(FStringView S, int32 OpenParen, FArgViews& OutArgs, int32& OutAfter)
 {
 	const int32 N = S.Len();
-	int32 i = OpenParen + 1, depth = 0;
-	FString Cur;
+	int32 i = OpenParen + 1, depth = 0, ArgStart = i;
 	while (i < N)
 	{
 		const TCHAR c = S[i];
-		if (c == '"' || c == '\'')
-		{
-			const TCHAR q = c; int32 j = i + 1;
-			while (j < N) { if (S[j] == '\\') { j += 2; continue; } if (S[j] == q) { ++j; break; } ++j; }
-			Cur += S.Mid(i, j - i); i = j; continue;
-		}
-		if (c == '(' || c == '[' || c == '{') { ++depth; Cur.AppendChar(c); ++i; continue; }
+		if (c == '"' || c == '\'') { i = SkipShort(S, i); continue; }
+		if (c == '(' || c == '[' || c == '{') { ++depth; ++i; continue; }
 		if (c == ')' || c == ']' || c == '}')
 		{
-			if (c == ')' && depth == 0) { OutArgs.Add(Cur); OutAfter = i + 1; return true; }
-			--depth; Cur.AppendChar(c); ++i; continue;
+			if (c == ')' && depth == 0) { OutArgs.Add(S.Mid(ArgStart, i - ArgStart)); OutAfter = i + 1; return true; }
+			--depth; ++i; continue;
 		}
-		if (c == ',' && depth == 0) { OutArgs.Add(Cur); Cur.Reset(); ++i; continue; }
-		Cur.AppendChar(c); ++i;
+		if (c == ',' && depth == 0) { OutArgs.Add(S.Mid(ArgStart, i - ArgStart)); ArgStart = ++i; continue; }
+		++i;
 	}
 	return false;
 }
 
-inline bool StringLiteralValue(const FString& In, FString& OutVal)
+inline bool StringLiteralValue(FStringView In, FStringView& OutVal)
 {
-	FString s = In.TrimStartAndEnd();
+	const FStringView s = In.TrimStartAndEnd();
 	if (s.Len() >= 2 && (s[0] == '"' || s[0] == '\'') && s[s.Len() - 1] == s[0])
 	{
 		OutVal = s.Mid(1, s.Len() - 2);
@@ -77,11 +108,20 @@ inline bool StringLiteralValue(const FString& In, FString& OutVal)
 	return false;
 }
 
-inline FString Rewrite(const FString& Src)
+inline void AppendView(FString& Out, FStringView View)
+{
+	Out.AppendChars(View.GetData(), View.Len());
+}
+
+// Streams the rewritten chunk into Out (appended), returns the number of rewritten calls.
+inline int32 RewriteInto(FStringView Src, FString& Out)
 {
+	static const FStringView Needle = TEXT("NotifyObjectMessage");
 	const int32 N = Src.Len();
-	FString Out;
-	Out.Reserve(N + 64);
+	Out.Reserve(Out.Len() + N + 64);
+
+	int32 NumRewritten = 0;
+	int32 Flushed = 0;
 	int32 i = 0;
 	while (i < N)
 	{
@@ -89,60 +129,140 @@ inline FString Rewrite(const FString& Src)
 		if (c == '-' && i + 1 < N && Src[i + 1] == '-')  // comment
 		{
 			int32 lvl = 0;
-			if (i + 2 < N && Src[i + 2] == '[' && LongBracketLevel(Src, i + 2, lvl))
+			if (LongBracketLevel(Src, i + 2, lvl))
 			{
-				const int32 e = SkipLong(Src, i + 2 + 1 + lvl + 1, lvl);
-				Out += Src.Mid(i, e - i); i = e; continue;
+				i = SkipLong(Src, i + 2 + 1 + lvl + 1, lvl);
+				continue;
 			}
-			int32 e = Src.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, i);
-			if (e < 0) e = N;
-			Out += Src.Mid(i, e - i); i = e; continue;
+			while (i < N && Src[i] != '\n') ++i;
+			continue;
 		}
 		int32 lvl = 0;
 		if (c == '[' && LongBracketLevel(Src, i, lvl))  // long string
 		{
-			const int32 e = SkipLong(Src, i + 1 + lvl + 1, lvl);
-			Out += Src.Mid(i, e - i); i = e; continue;
+			i = SkipLong(Src, i + 1 + lvl + 1, lvl);
+			continue;
 		}
 		if (c == '"' || c == '\'')  // short string
 		{
-			const TCHAR q = c; int32 j = i + 1;
-			while (j < N) { if (Src[j] == '\\') { j += 2; continue; } if (Src[j] == q) { ++j; break; } ++j; }
-			Out += Src.Mid(i, j - i); i = j; continue;
+			i = SkipShort(Src, i);
+			continue;
 		}
-		const bool bIdentStart = (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || c == '_';
-		if (bIdentStart)
+		if (IsIdentChar(c) && !(c >= '0' && c <= '9'))
 		{
 			int32 j = i + 1;
-			while (j < N) { const TCHAR d = Src[j]; if ((d >= '0' && d <= '9') || (d >= 'A' && d <= 'Z') || (d >= 'a' && d <= 'z') || d == '_') ++j; else break; }
-			const FString Word = Src.Mid(i, j - i);
-			if (Word == TEXT("NotifyObjectMessage"))
+			while (j < N && IsIdentChar(Src[j])) ++j;
+			if (Src.Mid(i, j - i).Equals(Needle, ESearchCase::CaseSensitive))
 			{
 				int32 k = j;
 				while (k < N && (Src[k] == ' ' || Src[k] == '\t')) ++k;
-				if (k < N && Src[k] == '(')
+				FArgViews Args;
+				int32 After = 0;
+				FStringView Key;
+				if (k < N && Src[k] == '(' && SplitArgs(Src, k, Args, After) && Args.Num() >= 2 && StringLiteralValue(Args[1], Key))
 				{
-					TArray<FString> Args; int32 After = 0;
-					if (SplitArgs(Src, k, Args, After) && Args.Num() >= 2)
-					{
-						FString Key;
-						if (StringLiteralValue(Args[1], Key))
-						{
-							FString Rep = TEXT("Notify_");
-							SanitizeInto(Rep, Key);
-							Rep.AppendChar('(');
-							Rep += Args[0].TrimStartAndEnd();
-							for (int32 a = 2; a < Args.Num(); ++a) { Rep += TEXT(", "); Rep += Args[a].TrimStartAndEnd(); }
-							Rep.AppendChar(')');
-							Out += Rep; i = After; continue;
-						}
-					}
+					AppendView(Out, Src.Mid(Flushed, i - Flushed));
+					Out += TEXT("Notify_");
+					SanitizeInto(Out, Key);
+					Out.AppendChar('(');
+					AppendView(Out, Args[0].TrimStartAndEnd());
+					for (int32 a = 2; a < Args.Num(); ++a) { Out += TEXT(", "); AppendView(Out, Args[a].TrimStartAndEnd()); }
+					Out.AppendChar(')');
+					++NumRewritten;
+					Flushed = i = After;
+					continue;
 				}
 			}
-			Out += Word; i = j; continue;
+			i = j;
+			continue;
 		}
-		Out.AppendChar(c); ++i;
+		++i;
 	}
+	AppendView(Out, Src.Mid(Flushed, N - Flushed));
+	return NumRewritten;
+}
+
+inline FString Rewrite(const FString& Src)
+{
+	// nothing to do for the vast majority of chunks
+	if (!Src.Contains(TEXT("NotifyObjectMessage"), ESearchCase::CaseSensitive))
+		return Src;
+
+	FString Out;
+	RewriteInto(FStringView(Src), Out);
 	return Out;
 }
+
+inline uint64 GetCacheKey(const FString& Src)
+{
+	const uint64 SrcHash = CityHash64(reinterpret_cast<const char*>(*Src), Src.Len() * sizeof(TCHAR));
+	return CityHash128to64({SrcHash, (uint64(FormatVersion) << 32) | uint32(Src.Len())});
+}
+
+// entries of a known source file are prefixed with its path hash, so its older revisions can be found and pruned
+inline FString GetCachePath(uint64 Key, const FString& SourcePath = FString())
+{
+	const FString Dir = FPaths::ProjectSavedDir() / TEXT("GMP") / TEXT("LuaRewrite");
+	if (SourcePath.IsEmpty())
+		return Dir / FString::Printf(TEXT("%016llx.lua"), Key);
+	return Dir / FString::Printf(TEXT("%08x-%016llx.lua"), FCrc::StrCrc32(*SourcePath.ToLower()), Key);
+}
+
+// deletes the other entries of the source file CachePath belongs to
+inline void PruneCache(const FString& CachePath)
+{
+	const FString Dir = FPaths::GetPath(CachePath);
+	const FString Name = FPaths::GetCleanFilename(CachePath);
+	int32 Dash = INDEX_NONE;
+	if (!Name.FindChar(TEXT('-'), Dash))
+		return;
+
+	TArray<FString> Files;
+	IFileManager::Get().FindFiles(Files, *(Dir / Name.Left(Dash + 1) + TEXT("*.lua")), true, false);
+	for (const FString& File : Files)
+	{
+		if (File != Name)
+			IFileManager::Get().Delete(*(Dir / File), false, false, true);
+	}
+}
+
+// Rewritten chunk as utf8 bytes appended to Out, served from the disk cache when the same source was rewritten before.
+// SourcePath names the file Src was loaded from, a new revision of it replaces the cached one.
+inline void RewriteToUtf8(const FString& Src, TArray<uint8>& Out, const FString& SourcePath = FString())
+{
+	auto AppendUtf8 = [&Out](const FString& Str) {
+		FTCHARToUTF8 Utf8(*Str, Str.Len());
+		Out.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	};
+	if (!Src.Contains(TEXT("NotifyObjectMessage"), ESearchCase::CaseSensitive))
+	{
+		AppendUtf8(Src);
+		return;
+	}
+
+#if GMP_LUA_REWRITE_CACHE
+	const FString CachePath = GetCachePath(GetCacheKey(Src), SourcePath);
+	if (Out.Num() == 0 && FFileHelper::LoadFileToArray(Out, *CachePath, FILEREAD_Silent))
+		return;
+#endif
+
+	FString Rewritten;
+	RewriteInto(FStringView(Src), Rewritten);
+	const int32 Offset = Out.Num();
+	AppendUtf8(Rewritten);
+
+#if GMP_LUA_REWRITE_CACHE
+	if (Offset == 0)
+	{
+		// write aside then move, concurrent loaders never observe a partial chunk
+		const FString TempPath = FPaths::CreateTempFilename(*FPaths::GetPath(CachePath), TEXT("Rewrite"), TEXT(".tmp"));
+		if (!FFileHelper::SaveArrayToFile(Out, *TempPath))
+			return;
+		if (IFileManager::Get().Move(*CachePath, *TempPath, true, true, false, true))
+			PruneCache(CachePath);
+		else
+			IFileManager::Get().Delete(*TempPath, false, false, true);
+	}
+#endif
+}
 }  // namespace GMPLuaRewrite
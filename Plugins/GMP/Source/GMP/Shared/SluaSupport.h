@@ -297,10 +297,8 @@ inline TArray<uint8> GMP_Slua_LoadFile(const char* fn, FString& filepath)
 		if (FFileHelper::LoadFileToString(Raw, *Full))
 		{
 			filepath = Full;
-			const FString Rewritten = GMPLuaRewrite::Rewrite(Raw);
-			FTCHARToUTF8 Utf8(*Rewritten);
 			TArray<uint8> Out;
-			Out.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+			GMPLuaRewrite::RewriteToUtf8(Raw, Out, Full);
 			return Out;
 		}
 	}
@@ -873,9 +873,7 @@ inline void GMP_ExportToLuaEx()
 							if (FFileHelper::LoadFileToString(Raw, *Full))
 							{
 								ChunkName = Full;
-								const FString Rewritten = GMPLuaRewrite::Rewrite(Raw);
-								FTCHARToUTF8 Utf8(*Rewritten);
-								Data.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+								GMPLuaRewrite::RewriteToUtf8(Raw, Data, Full);
 								return true;
 							}
 						}
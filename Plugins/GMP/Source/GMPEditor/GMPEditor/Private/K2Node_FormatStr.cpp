@@ -380,29 +380,54 @@ void UK2Node_FormatStr::ExpandNode(class FKismetCompilerContext& CompilerContext
 
 	const UEdGraphSchema_K2* K2_Schema = CompilerContext.GetSchema();
 	UK2Node_CallFunction* CallFormatFunction = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
-	if (!IsLegacyFormat())
+
+	// a literal format is resolved against the argument names here, the node then calls FormatStringByOrder without any names
+	FString BakedFormat;
+	bool bBakedFormat = false;
+	if (!IsLegacyFormat() && GetFormatPin()->LinkedTo.Num() == 0)
 	{
-		CallFormatFunction->SetFromFunction(UGMPBPLib::StaticClass()->FindFunctionByName(GET_MEMBER_NAME_CHECKED(UGMPBPLib, FormatStringByName)));
-		CallFormatFunction->AllocateDefaultPins();
-		CompilerContext.MessageLog.NotifyIntermediateObjectCreation(CallFormatFunction, this);
+		TArray<FString> Names;
+		for (const FName& PinName : PinNames)
+			Names.Add(PinName.ToString());
+		bBakedFormat = UGMPBPLib::BakeFormatByName(GetFormatPin()->DefaultValue, Names, BakedFormat);
+	}
 
-		UK2Node_MakeArray* MakeArrayNode = CompilerContext.SpawnIntermediateNode<UK2Node_MakeArray>(this, SourceGraph);
-		MakeArrayNode->AllocateDefaultPins();
-		CompilerContext.MessageLog.NotifyIntermediateObjectCreation(MakeArrayNode, this);
-		UEdGraphPin* ArrayOut = MakeArrayNode->GetOutputPin();
-		ArrayOut->MakeLinkTo(CallFormatFunction->FindPinChecked(TEXT("InNames")));
-		MakeArrayNode->PinConnectionListChanged(ArrayOut);
+	if (!IsLegacyFormat())
+	{
+		UK2Node_MakeArray* MakeArrayNode = nullptr;
+		if (bBakedFormat)
+		{
+			CallFormatFunction->SetFromFunction(UGMPBPLib::StaticClass()->FindFunctionByName(GET_MEMBER_NAME_CHECKED(UGMPBPLib, FormatStringByOrder)));
+			CallFormatFunction->AllocateDefaultPins();
+			CompilerContext.MessageLog.NotifyIntermediateObjectCreation(CallFormatFunction, this);
+		}
+		else
+		{
+			CallFormatFunction->SetFromFunction(UGMPBPLib::StaticClass()->FindFunctionByName(GET_MEMBER_NAME_CHECKED(UGMPBPLib, FormatStringByName)));
+			CallFormatFunction->AllocateDefaultPins();
+			CompilerContext.MessageLog.NotifyIntermediateObjectCreation(CallFormatFunction, this);
+
+			MakeArrayNode = CompilerContext.SpawnIntermediateNode<UK2Node_MakeArray>(this, SourceGraph);
+			MakeArrayNode->AllocateDefaultPins();
+			CompilerContext.MessageLog.NotifyIntermediateObjectCreation(MakeArrayNode, this);
+			UEdGraphPin* ArrayOut = MakeArrayNode->GetOutputPin();
+			ArrayOut->MakeLinkTo(CallFormatFunction->FindPinChecked(TEXT("InNames")));
+			MakeArrayNode->PinConnectionListChanged(ArrayOut);
+		}
 
 		UEdGraphPin* FallbackValuePin = nullptr;
 		for (int32 ArgIdx = 0; ArgIdx < PinNames.Num(); ++ArgIdx)
 		{
 			UEdGraphPin* ArgumentPin = FindArgumentPin(PinNames[ArgIdx]);
-			if (ArgIdx > 0)
+			if (MakeArrayNode)
 			{
-				MakeArrayNode->AddInputPin();
+				if (ArgIdx > 0)
+				{
+					MakeArrayNode->AddInputPin();
+				}
+				auto MapArrayPin = MakeArrayNode->FindPinChecked(MakeArrayNode->GetPinName(ArgIdx));
+				K2_Schema->TrySetDefaultValue(*MapArrayPin, PinNames[ArgIdx].ToString());
 			}
-			auto MapArrayPin = MakeArrayNode->FindPinChecked(MakeArrayNode->GetPinName(ArgIdx));
-			K2_Schema->TrySetDefaultValue(*MapArrayPin, PinNames[ArgIdx].ToString());
 
 			if (ArgumentPin->LinkedTo.Num() == 0)
 			{
@@ -475,7 +500,10 @@ void UK2Node_FormatStr::ExpandNode(class FKismetCompilerContext& CompilerContext
 		}
 	}
 	CompilerContext.MovePinLinksToIntermediate(*FindPinChecked(TEXT("Result")), *CallFormatFunction->GetReturnValuePin());
-	CompilerContext.MovePinLinksToIntermediate(*GetFormatPin(), *CallFormatFunction->FindPinChecked(TEXT("InFmtStr")));
+	if (bBakedFormat)
+		K2_Schema->TrySetDefaultValue(*CallFormatFunction->FindPinChecked(TEXT("InFmtStr")), BakedFormat);
+	else
+		CompilerContext.MovePinLinksToIntermediate(*GetFormatPin(), *CallFormatFunction->FindPinChecked(TEXT("InFmtStr")));
 	BreakAllNodeLinks();
 }
 
@@ -9,7 +9,6 @@
 #include "GMP/GMPBPLib.h"
 #include "K2Node_CallFunction.h"
 #include "K2Node_Knot.h"
-#include "K2Node_MakeArray.h"
 #include "K2Node_Self.h"
 #include "KismetCompiler.h"
 #include "Styling/AppStyle.h"
@@ -52,6 +51,18 @@ UClass* UK2Node_GMPGenericInvoker::GetTargetPinClass() const
 	return GetBlueprintClassFromNode();
 }
 
+FString UK2Node_GMPGenericInvoker::GetChainNameLiteral() const
+{
+	TStringBuilder<256> Builder;
+	for (int32 i = 0; i < MemberChain.Num(); ++i)
+	{
+		if (i > 0)
+			Builder.AppendChar(TEXT('.'));
+		Builder.Append(MemberChain[i].MemberRef.GetMemberName().ToString());
+	}
+	return Builder.ToString();
+}
+
 void UK2Node_GMPGenericInvoker::ClassifyAndCache(FGMPMemberChainLink& Link, FProperty* Prop) const
 {
 	const UEdGraphSchema_K2* K2Schema = GetDefault<UEdGraphSchema_K2>();
@@ -430,25 +441,12 @@ void UK2Node_GMPGenericInvoker::ExpandNode(class FKismetCompilerContext& Compile
 		}
 
 		UK2Node_CallFunction* CallNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
-		CallNode->SetFromFunction(UGMPBPLib::StaticClass()->FindFunctionByName(GET_MEMBER_NAME_CHECKED(UGMPBPLib, GetMemberByChain)));
+		CallNode->SetFromFunction(UGMPBPLib::StaticClass()->FindFunctionByName(GET_MEMBER_NAME_CHECKED(UGMPBPLib, GetMemberByChainName)));
 		CallNode->AllocateDefaultPins();
 		CompilerContext.MessageLog.NotifyIntermediateObjectCreation(CallNode, this);
 
 		bErrorFree &= WireTargetTo(CallNode->FindPinChecked(TEXT("InObject")));
-
-		UK2Node_MakeArray* MakeArr = CompilerContext.SpawnIntermediateNode<UK2Node_MakeArray>(this, SourceGraph);
-		MakeArr->AllocateDefaultPins();
-		CompilerContext.MessageLog.NotifyIntermediateObjectCreation(MakeArr, this);
-		UEdGraphPin* ArrayOut = MakeArr->GetOutputPin();
-		ArrayOut->MakeLinkTo(CallNode->FindPinChecked(TEXT("Chain")));
-		MakeArr->PinConnectionListChanged(ArrayOut);
-		for (int32 i = 0; i < MemberChain.Num(); ++i)
-		{
-			if (i > 0)
-				MakeArr->AddInputPin();
-			UEdGraphPin* ElemPin = MakeArr->FindPinChecked(MakeArr->GetPinName(i));
-			K2Schema->TrySetDefaultValue(*ElemPin, MemberChain[i].MemberRef.GetMemberName().ToString());
-		}
+		K2Schema->TrySetDefaultValue(*CallNode->FindPinChecked(TEXT("ChainName")), GetChainNameLiteral());
 
 		UEdGraphPin* OutValuePin = CallNode->FindPinChecked(TEXT("OutValue"));
 		OutValuePin->PinType = CachedOutputType;
@@ -469,25 +467,12 @@ void UK2Node_GMPGenericInvoker::ExpandNode(class FKismetCompilerContext& Compile
 		if (MemberChain.Num() > 0)
 		{
 			UK2Node_CallFunction* ChainNode = CompilerContext.SpawnIntermediateNode<UK2Node_CallFunction>(this, SourceGraph);
-			ChainNode->SetFromFunction(UGMPBPLib::StaticClass()->FindFunctionByName(GET_MEMBER_NAME_CHECKED(UGMPBPLib, GetMemberByChain)));
+			ChainNode->SetFromFunction(UGMPBPLib::StaticClass()->FindFunctionByName(GET_MEMBER_NAME_CHECKED(UGMPBPLib, GetMemberByChainName)));
 			ChainNode->AllocateDefaultPins();
 			CompilerContext.MessageLog.NotifyIntermediateObjectCreation(ChainNode, this);
 
 			bErrorFree &= WireTargetTo(ChainNode->FindPinChecked(TEXT("InObject")));
-
-			UK2Node_MakeArray* MakeChain = CompilerContext.SpawnIntermediateNode<UK2Node_MakeArray>(this, SourceGraph);
-			MakeChain->AllocateDefaultPins();
-			CompilerContext.MessageLog.NotifyIntermediateObjectCreation(MakeChain, this);
-			UEdGraphPin* ChainArrayOut = MakeChain->GetOutputPin();
-			ChainArrayOut->MakeLinkTo(ChainNode->FindPinChecked(TEXT("Chain")));
-			MakeChain->PinConnectionListChanged(ChainArrayOut);
-			for (int32 i = 0; i < MemberChain.Num(); ++i)
-			{
-				if (i > 0)
-					MakeChain->AddInputPin();
-				UEdGraphPin* ElemPin = MakeChain->FindPinChecked(MakeChain->GetPinName(i));
-				K2Schema->TrySetDefaultValue(*ElemPin, MemberChain[i].MemberRef.GetMemberName().ToString());
-			}
+			K2Schema->TrySetDefaultValue(*ChainNode->FindPinChecked(TEXT("ChainName")), GetChainNameLiteral());
 
 			EndpointObjPin = ChainNode->FindPinChecked(TEXT("OutValue"));
 			EndpointObjPin->PinType.PinCategory = UEdGraphSchema_K2::PC_Object;
@@ -106,6 +106,8 @@ public:
 private:
 	void ClassifyAndCache(FGMPMemberChainLink& Link, FProperty* Prop) const;
 	bool IsFunctionPure() const;
+	// "A.B.C", baked into the GetMemberByChainName call as one name literal.
+	FString GetChainNameLiteral() const;
 
 	FNodeTextCache CachedNodeTitle;
 };
@@ -525,7 +525,8 @@ void UK2Node_NotifyMessage::ExpandNode(class FKismetCompilerContext& CompilerCon
 	auto ResponsedPin = FindPinChecked(GMPNotifyMessage::Responed, EGPD_Output);
 	const bool bResponsed = ResponsedPin && ResponsedPin->LinkedTo.Num() > 0;
 
-	UFunction* NotifyMessageFunc = (UE_4_25_OR_LATER) ? (bResponsed ? GMP_UFUNCTION_CHECKED(UGMPBPLib, NotifyMessageByKeyVariadicRet) : GMP_UFUNCTION_CHECKED(UGMPBPLib, NotifyMessageByKeyVariadic))
+	// the variadic thunks take the key as a name literal, interned once when the blueprint loads
+	UFunction* NotifyMessageFunc = (UE_4_25_OR_LATER) ? (bResponsed ? GMP_UFUNCTION_CHECKED(UGMPBPLib, NotifyMessageByNameVariadicRet) : GMP_UFUNCTION_CHECKED(UGMPBPLib, NotifyMessageByNameVariadic))
 													  : (bResponsed ? GMP_UFUNCTION_CHECKED(UGMPBPLib, NotifyMessageByKeyRet) : GMP_UFUNCTION_CHECKED(UGMPBPLib, NotifyMessageByKey));
 	UFunction* RequestMessageFunc = (UE_4_25_OR_LATER) ? (bResponsed ? GMP_UFUNCTION_CHECKED(UGMPBPLib, RequestMessageVariadicRet) : GMP_UFUNCTION_CHECKED(UGMPBPLib, RequestMessageVariadic))
 													   : (bResponsed ? GMP_UFUNCTION_CHECKED(UGMPBPLib, RequestMessageRet) : GMP_UFUNCTION_CHECKED(UGMPBPLib, RequestMessage));